@@ -1,84 +1,102 @@
 #include "axdr.h"
+#include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 // 上下文操作函数实现
 AXDR_CODEC* axdr_codec_init(uint8_t* buffer, size_t size) {
     AXDR_CODEC* codec = (AXDR_CODEC*)malloc(sizeof(AXDR_CODEC));
     if (codec) {
-        codec->buffer = buffer;
-        codec->size = size;
-        codec->position = 0;
-        codec->error = AXDR_SUCCESS;
+        axdr_codec_attach(codec, buffer, size);
     }
     return codec;
 }
 
+// 在调用者提供的上下文上绑定缓冲区（不分配内存）
+void axdr_codec_attach(AXDR_CODEC* codec, uint8_t* buffer, size_t size) {
+    codec->buffer = buffer;
+    codec->size = size;
+    codec->position = 0;
+    codec->error = AXDR_SUCCESS;
+    codec->errorOffset = 0;
+    codec->checksumType = 0;
+    codec->checksum = 0;
+    codec->checksumMark = 0;
+    codec->budget = NULL;
+}
+
 void axdr_codec_cleanup(AXDR_CODEC* codec) {
     free(codec);
 }
 
-// 整数编码实现
-int axdr_encode_integer(AXDR_CODEC* codec, int32_t value, int32_t min, int32_t max) {
-    // 约束检查
-    if (value < min || value > max) {
-        return AXDR_ERROR_CONSTRAINT;
-    }
-    
-    // 确保缓冲区足够
-    if (codec->position + 4 > codec->size) {
-        return AXDR_ERROR_BUFFER_OVERFLOW;
-    }
-    
-    // 网络字节序编码（大端序）
-    codec->buffer[codec->position++] = (value >> 24) & 0xFF;
-    codec->buffer[codec->position++] = (value >> 16) & 0xFF;
-    codec->buffer[codec->position++] = (value >> 8) & 0xFF;
-    codec->buffer[codec->position++] = value & 0xFF;
-    
-    return AXDR_SUCCESS;
+// 解码预算
+void axdr_budget_init(AXDR_DECODE_BUDGET* budget, size_t maxOutputBytes, size_t maxElements,
+                      size_t maxDepth, size_t maxWork) {
+    budget->maxOutputBytes = maxOutputBytes;
+    budget->maxElements = maxElements;
+    budget->maxDepth = maxDepth;
+    budget->maxWork = maxWork;
+    axdr_budget_reset(budget);
 }
 
-// 无符号整数编码实现
-int axdr_encode_unsigned(AXDR_CODEC* codec, uint32_t value, uint32_t max) {
-    // 约束检查
-    if (value > max) {
-        return AXDR_ERROR_CONSTRAINT;
-    }
-    
-    // 确保缓冲区足够
-    if (codec->position + 4 > codec->size) {
-        return AXDR_ERROR_BUFFER_OVERFLOW;
+void axdr_budget_reset(AXDR_DECODE_BUDGET* budget) {
+    budget->outputBytes = 0;
+    budget->elements = 0;
+    budget->depth = 0;
+    budget->work = 0;
+}
+
+// 在 used 上计入 amount，超过 limit（非 0）时失败
+static inline int budget_charge(AXDR_CODEC* codec, size_t* used, size_t limit, size_t amount) {
+    if (limit != 0 && amount > limit - *used) {
+        codec->error = AXDR_ERROR_BUDGET;
+        codec->errorOffset = codec->position;
+        return AXDR_ERROR_BUDGET;
     }
-    
-    // 网络字节序编码
-    codec->buffer[codec->position++] = (value >> 24) & 0xFF;
-    codec->buffer[codec->position++] = (value >> 16) & 0xFF;
-    codec->buffer[codec->position++] = (value >> 8) & 0xFF;
-    codec->buffer[codec->position++] = value & 0xFF;
-    
+    *used += amount;
     return AXDR_SUCCESS;
 }
 
-// 布尔值编码实现
-int axdr_encode_boolean(AXDR_CODEC* codec, bool value) {
-    if (codec->position + 1 > codec->size) {
-        return AXDR_ERROR_BUFFER_OVERFLOW;
+int axdr_budget_output(AXDR_CODEC* codec, size_t bytes) {
+    AXDR_DECODE_BUDGET* budget = codec->budget;
+    return budget ? budget_charge(codec, &budget->outputBytes, budget->maxOutputBytes, bytes) : AXDR_SUCCESS;
+}
+
+int axdr_budget_work(AXDR_CODEC* codec, size_t units) {
+    AXDR_DECODE_BUDGET* budget = codec->budget;
+    return budget ? budget_charge(codec, &budget->work, budget->maxWork, units) : AXDR_SUCCESS;
+}
+
+int axdr_budget_elements(AXDR_CODEC* codec, size_t count) {
+    AXDR_DECODE_BUDGET* budget = codec->budget;
+    if (!budget) {
+        return AXDR_SUCCESS;
     }
-    
-    codec->buffer[codec->position++] = value ? 0xFF : 0x00;
-    return AXDR_SUCCESS;
+    int result = budget_charge(codec, &budget->elements, budget->maxElements, count);
+    return result == AXDR_SUCCESS ? budget_charge(codec, &budget->work, budget->maxWork, count) : result;
 }
 
-// 枚举编码实现
-int axdr_encode_enum(AXDR_CODEC* codec, int value, int count) {
-    if (value < 0 || value >= count) {
-        return AXDR_ERROR_CONSTRAINT;
+int axdr_budget_enter(AXDR_CODEC* codec) {
+    AXDR_DECODE_BUDGET* budget = codec->budget;
+    return budget ? budget_charge(codec, &budget->depth, budget->maxDepth, 1) : AXDR_SUCCESS;
+}
+
+void axdr_budget_leave(AXDR_CODEC* codec) {
+    if (codec->budget && codec->budget->depth > 0) {
+        codec->budget->depth--;
     }
-    
-    return axdr_encode_integer(codec, value, 0, count - 1);
 }
 
+// 定长基本类型：未启用内联时在此生成外部定义
+#ifndef AXDR_INLINE_PRIMITIVES
+#define AXDR_PRIMITIVE
+#include "axdr_inline.h"
+#endif
+
 // 位串编码实现
 int axdr_encode_bit_string(AXDR_CODEC* codec, const uint8_t* bits, size_t length) {
     // 编码长度
@@ -92,6 +110,7 @@ int axdr_encode_bit_string(AXDR_CODEC* codec, const uint8_t* bits, size_t length
     size_t byte_length = (length + 7) / 8;
     memcpy(codec->buffer + codec->position, bits, byte_length);
     codec->position += byte_length;
+    axdr_checksum_fold(codec);
     
     return AXDR_SUCCESS;
 }
@@ -108,18 +127,106 @@ int axdr_encode_octet_string(AXDR_CODEC* codec, const uint8_t* octets, size_t le
     // 编码内容
     memcpy(codec->buffer + codec->position, octets, length);
     codec->position += length;
+    axdr_checksum_fold(codec);
     
     return AXDR_SUCCESS;
 }
 
-// 可视串编码实现
-int axdr_encode_visible_string(AXDR_CODEC* codec, const char* str, size_t max_length) {
-    size_t length = strlen(str);
-    if (length > max_length) {
+// 可视字符范围 0x20-0x7E
+static inline int visible_char(uint8_t c) {
+    return c >= 0x20 && c <= 0x7E;
+}
+
+#if defined(__SSE2__)
+// 16 个字节中不可见字符（含 '\0'）的位掩码：有符号比较下 0x80-0xFF 也小于 0x20
+static inline unsigned visible_mask(__m128i v) {
+    __m128i low = _mm_cmplt_epi8(v, _mm_set1_epi8(0x20));
+    __m128i del = _mm_cmpeq_epi8(v, _mm_set1_epi8(0x7F));
+    return (unsigned)_mm_movemask_epi8(_mm_or_si128(low, del));
+}
+#endif
+
+// 校验并拷贝已知长度的内容
+size_t axdr_visible_copy(const uint8_t* src, size_t length, uint8_t* dst) {
+    size_t i = 0;
+#if defined(__SSE2__)
+    for (; i + 16 <= length; i += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i*)(src + i));
+        unsigned mask = visible_mask(v);
+        if (mask != 0) {
+            return i + (size_t)__builtin_ctz(mask);
+        }
+        if (dst) {
+            _mm_storeu_si128((__m128i*)(dst + i), v);
+        }
+    }
+#endif
+    for (; i < length; i++) {
+        if (!visible_char(src[i])) {
+            return i;
+        }
+        if (dst) {
+            dst[i] = src[i];
+        }
+    }
+    return length;
+}
+
+// 扫描以 '\0' 结尾的字符串，同时校验并拷贝到 dst（只拷贝前 room 个字节）
+// 返回 AXDR_SUCCESS 并给出长度；超过 limit 返回约束错误；遇到不可见字符返回其偏移。
+// 先以 memchr 求出不超过 limit + 1 的长度（找到 '\0' 即停止），校验与拷贝只读取字符串本身的字节
+static int visible_scan(const char* str, size_t limit, uint8_t* dst, size_t room,
+                        size_t* length, size_t* offset) {
+    const uint8_t* src = (const uint8_t*)str;
+    size_t n;
+    if (limit < PTRDIFF_MAX) {
+        const char* end = (const char*)memchr(str, '\0', limit + 1);
+        n = end ? (size_t)(end - str) : limit + 1;
+    } else {
+        n = strlen(str);
+    }
+    size_t checked = n < limit ? n : limit;
+    size_t copied = checked < room ? checked : room;
+
+    size_t valid = axdr_visible_copy(src, copied, dst);
+    if (valid == copied && copied < checked) {
+        valid = copied + axdr_visible_copy(src + copied, checked - copied, NULL);
+    }
+    if (valid < checked) {
+        *offset = valid;
+        return AXDR_ERROR_INVALID_VALUE;
+    }
+    if (n > limit) {
         return AXDR_ERROR_CONSTRAINT;
     }
-    
-    return axdr_encode_octet_string(codec, (const uint8_t*)str, length);
+    *length = n;
+    return AXDR_SUCCESS;
+}
+
+// 可视串编码实现：一次扫描完成求长度、范围校验和拷贝
+int axdr_encode_visible_string(AXDR_CODEC* codec, const char* str, size_t max_length) {
+    size_t room = codec->position + 4 <= codec->size ? codec->size - codec->position - 4 : 0;
+    uint8_t* dst = codec->buffer + codec->position + (room > 0 ? 4 : 0);
+    size_t length = 0;
+    size_t offset = 0;
+
+    int result = visible_scan(str, max_length, dst, room, &length, &offset);
+    if (result == AXDR_ERROR_INVALID_VALUE) {
+        codec->error = result;
+        codec->errorOffset = offset;
+        return result;
+    }
+    if (result != AXDR_SUCCESS) {
+        return result;
+    }
+    if (codec->position + 4 + length > codec->size) {
+        return AXDR_ERROR_BUFFER_OVERFLOW;
+    }
+
+    axdr_encode_unsigned(codec, (uint32_t)length, UINT32_MAX);
+    codec->position += length;
+    axdr_checksum_fold(codec);
+    return AXDR_SUCCESS;
 }
 
 // 通用时间编码实现
@@ -131,68 +238,61 @@ int axdr_encode_generalized_time(AXDR_CODEC* codec, time_t time) {
     return axdr_encode_visible_string(codec, time_str, 14);
 }
 
-// NULL值编码实现
-int axdr_encode_null(AXDR_CODEC* codec) {
-    // NULL类型不需要编码任何内容
-    return AXDR_SUCCESS;
+// 浮点数：IEEE 754 位模式按无符号整数高字节在前写出
+static void float_store(AXDR_CODEC* codec, uint64_t bits, size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        codec->buffer[codec->position + i] = (uint8_t)(bits >> (8 * (size - 1 - i)));
+    }
+    codec->position += size;
+    axdr_checksum_fold(codec);
+}
+
+static uint64_t float_load(AXDR_CODEC* codec, size_t size) {
+    uint64_t bits = 0;
+    for (size_t i = 0; i < size; i++) {
+        bits = (bits << 8) | codec->buffer[codec->position + i];
+    }
+    codec->position += size;
+    axdr_checksum_fold(codec);
+    return bits;
 }
 
-// 整数解码实现
-int axdr_decode_integer(AXDR_CODEC* codec, int32_t* value, int32_t min, int32_t max) {
+int axdr_encode_float32(AXDR_CODEC* codec, float value) {
     if (codec->position + 4 > codec->size) {
         return AXDR_ERROR_BUFFER_OVERFLOW;
     }
-    
-    *value = (codec->buffer[codec->position] << 24) |
-             (codec->buffer[codec->position + 1] << 16) |
-             (codec->buffer[codec->position + 2] << 8) |
-             codec->buffer[codec->position + 3];
-    codec->position += 4;
-    
-    if (*value < min || *value > max) {
-        return AXDR_ERROR_CONSTRAINT;
-    }
-    
+    uint32_t bits;
+    memcpy(&bits, &value, 4);
+    float_store(codec, bits, 4);
     return AXDR_SUCCESS;
 }
 
-// 无符号整数解码实现
-int axdr_decode_unsigned(AXDR_CODEC* codec, uint32_t* value, uint32_t max) {
-    if (codec->position + 4 > codec->size) {
+int axdr_encode_float64(AXDR_CODEC* codec, double value) {
+    if (codec->position + 8 > codec->size) {
         return AXDR_ERROR_BUFFER_OVERFLOW;
     }
-    
-    *value = ((uint32_t)codec->buffer[codec->position] << 24) |
-             ((uint32_t)codec->buffer[codec->position + 1] << 16) |
-             ((uint32_t)codec->buffer[codec->position + 2] << 8) |
-             (uint32_t)codec->buffer[codec->position + 3];
-    codec->position += 4;
-    
-    if (*value > max) {
-        return AXDR_ERROR_CONSTRAINT;
-    }
-    
+    uint64_t bits;
+    memcpy(&bits, &value, 8);
+    float_store(codec, bits, 8);
     return AXDR_SUCCESS;
 }
 
-// 布尔值解码实现
-int axdr_decode_boolean(AXDR_CODEC* codec, bool* value) {
-    if (codec->position + 1 > codec->size) {
+int axdr_decode_float32(AXDR_CODEC* codec, float* value) {
+    if (codec->position + 4 > codec->size) {
         return AXDR_ERROR_BUFFER_OVERFLOW;
     }
-    
-    *value = (codec->buffer[codec->position++] != 0);
+    uint32_t bits = (uint32_t)float_load(codec, 4);
+    memcpy(value, &bits, 4);
     return AXDR_SUCCESS;
 }
 
-// 枚举解码实现
-int axdr_decode_enum(AXDR_CODEC* codec, int* value, int count) {
-    int32_t temp;
-    int result = axdr_decode_integer(codec, &temp, 0, count - 1);
-    if (result == AXDR_SUCCESS) {
-        *value = temp;
+int axdr_decode_float64(AXDR_CODEC* codec, double* value) {
+    if (codec->position + 8 > codec->size) {
+        return AXDR_ERROR_BUFFER_OVERFLOW;
     }
-    return result;
+    uint64_t bits = float_load(codec, 8);
+    memcpy(value, &bits, 8);
+    return AXDR_SUCCESS;
 }
 
 // 位串解码实现
@@ -204,14 +304,19 @@ int axdr_decode_bit_string(AXDR_CODEC* codec, uint8_t* bits, size_t* length) {
     }
     
     *length = bit_length;
-    size_t byte_length = (bit_length + 7) / 8;
+    size_t byte_length = ((size_t)bit_length + 7) / 8;
     
     if (codec->position + byte_length > codec->size) {
         return AXDR_ERROR_BUFFER_OVERFLOW;
     }
+    result = axdr_budget_output(codec, byte_length);
+    if (result != AXDR_SUCCESS) {
+        return result;
+    }
     
     memcpy(bits, codec->buffer + codec->position, byte_length);
     codec->position += byte_length;
+    axdr_checksum_fold(codec);
     
     return AXDR_SUCCESS;
 }
@@ -229,26 +334,113 @@ int axdr_decode_octet_string(AXDR_CODEC* codec, uint8_t* octets, size_t* length)
     if (codec->position + str_length > codec->size) {
         return AXDR_ERROR_BUFFER_OVERFLOW;
     }
+    result = axdr_budget_output(codec, str_length);
+    if (result != AXDR_SUCCESS) {
+        return result;
+    }
     
     memcpy(octets, codec->buffer + codec->position, str_length);
     codec->position += str_length;
+    axdr_checksum_fold(codec);
     
     return AXDR_SUCCESS;
 }
 
-// 可视串解码实现
+// 按容量解码字节串：长度、剩余数据与预算都在拷贝前检查
+int axdr_decode_octet_string_bounded(AXDR_CODEC* codec, uint8_t* octets, size_t capacity, size_t* length) {
+    size_t start = codec->position;
+    uint32_t str_length;
+    int result = axdr_decode_unsigned(codec, &str_length, UINT32_MAX);
+    if (result != AXDR_SUCCESS) {
+        return result;
+    }
+
+    if (str_length > capacity) {
+        codec->position = start;
+        return AXDR_ERROR_CONSTRAINT;
+    }
+    if (str_length > codec->size - codec->position) {
+        codec->position = start;
+        return AXDR_ERROR_BUFFER_OVERFLOW;
+    }
+    result = axdr_budget_output(codec, str_length);
+    if (result != AXDR_SUCCESS) {
+        codec->position = start;
+        return result;
+    }
+
+    memcpy(octets, codec->buffer + codec->position, str_length);
+    codec->position += str_length;
+    axdr_checksum_fold(codec);
+    *length = str_length;
+    return AXDR_SUCCESS;
+}
+
+// 按容量解码位串，capacityBits 为 bits 可容纳的位数
+int axdr_decode_bit_string_bounded(AXDR_CODEC* codec, uint8_t* bits, size_t capacityBits, size_t* length) {
+    size_t start = codec->position;
+    uint32_t bit_length;
+    int result = axdr_decode_unsigned(codec, &bit_length, UINT32_MAX);
+    if (result != AXDR_SUCCESS) {
+        return result;
+    }
+
+    if (bit_length > capacityBits) {
+        codec->position = start;
+        return AXDR_ERROR_CONSTRAINT;
+    }
+    size_t byte_length = ((size_t)bit_length + 7) / 8;
+    if (byte_length > codec->size - codec->position) {
+        codec->position = start;
+        return AXDR_ERROR_BUFFER_OVERFLOW;
+    }
+    result = axdr_budget_output(codec, byte_length);
+    if (result != AXDR_SUCCESS) {
+        codec->position = start;
+        return result;
+    }
+
+    memcpy(bits, codec->buffer + codec->position, byte_length);
+    codec->position += byte_length;
+    axdr_checksum_fold(codec);
+    *length = bit_length;
+    return AXDR_SUCCESS;
+}
+
+// 可视串解码实现：先检查长度，再在拷贝的同时校验字符范围
 int axdr_decode_visible_string(AXDR_CODEC* codec, char* str, size_t max_length) {
-    size_t length;
-    int result = axdr_decode_octet_string(codec, (uint8_t*)str, &length);
+    size_t start = codec->position;
+    uint32_t length;
+    int result = axdr_decode_unsigned(codec, &length, UINT32_MAX);
     if (result != AXDR_SUCCESS) {
         return result;
     }
-    
+
     if (length > max_length) {
+        codec->position = start;
         return AXDR_ERROR_CONSTRAINT;
     }
-    
+    if (length > codec->size - codec->position) {
+        codec->position = start;
+        return AXDR_ERROR_BUFFER_OVERFLOW;
+    }
+    result = axdr_budget_output(codec, length);
+    if (result != AXDR_SUCCESS) {
+        codec->position = start;
+        return result;
+    }
+
+    size_t valid = axdr_visible_copy(codec->buffer + codec->position, length, (uint8_t*)str);
+    if (valid != length) {
+        codec->error = AXDR_ERROR_INVALID_VALUE;
+        codec->errorOffset = codec->position + valid;
+        codec->position = start;
+        return AXDR_ERROR_INVALID_VALUE;
+    }
+
     str[length] = '\0';
+    codec->position += length;
+    axdr_checksum_fold(codec);
     return AXDR_SUCCESS;
 }
 
@@ -274,47 +466,6 @@ int axdr_decode_generalized_time(AXDR_CODEC* codec, time_t* time) {
     return AXDR_SUCCESS;
 }
 
-// NULL值解码实现
-int axdr_decode_null(AXDR_CODEC* codec) {
-    // NULL类型不需要解码任何内容
-    return AXDR_SUCCESS;
-}
-
-// 可变长度整型编码（BER风格，最小字节数）
-int axdr_encode_varint(AXDR_CODEC* codec, int32_t value) {
-    uint8_t buf[5];
-    int len = 0;
-    uint32_t uval = (uint32_t)value;
-    // ZigZag编码可选，这里直接用无符号
-    do {
-        buf[len] = uval & 0x7F;
-        uval >>= 7;
-        if (uval) buf[len] |= 0x80;
-        len++;
-    } while (uval && len < 5);
-    if (codec->position + len > codec->size) return AXDR_ERROR_BUFFER_OVERFLOW;
-    memcpy(codec->buffer + codec->position, buf, len);
-    codec->position += len;
-    return AXDR_SUCCESS;
-}
-
-// 可变长度整型解码
-int axdr_decode_varint(AXDR_CODEC* codec, int32_t* value) {
-    uint32_t result = 0;
-    int shift = 0;
-    int i = 0;
-    while (i < 5) {
-        if (codec->position >= codec->size) return AXDR_ERROR_BUFFER_OVERFLOW;
-        uint8_t byte = codec->buffer[codec->position++];
-        result |= (uint32_t)(byte & 0x7F) << shift;
-        if (!(byte & 0x80)) break;
-        shift += 7;
-        i++;
-    }
-    *value = (int32_t)result;
-    return AXDR_SUCCESS;
-}
-
 // 可变长度字节串编码
 int axdr_encode_varoctet_string(AXDR_CODEC* codec, const uint8_t* octets, size_t length) {
     int res = axdr_encode_varint(codec, (int32_t)length);
@@ -322,6 +473,7 @@ int axdr_encode_varoctet_string(AXDR_CODEC* codec, const uint8_t* octets, size_t
     if (codec->position + length > codec->size) return AXDR_ERROR_BUFFER_OVERFLOW;
     memcpy(codec->buffer + codec->position, octets, length);
     codec->position += length;
+    axdr_checksum_fold(codec);
     return AXDR_SUCCESS;
 }
 
@@ -332,8 +484,11 @@ int axdr_decode_varoctet_string(AXDR_CODEC* codec, uint8_t* octets, size_t* leng
     if (res != AXDR_SUCCESS) return res;
     if (len < 0 || (size_t)len > max_length) return AXDR_ERROR_CONSTRAINT;
     if (codec->position + len > codec->size) return AXDR_ERROR_BUFFER_OVERFLOW;
+    res = axdr_budget_output(codec, (size_t)len);
+    if (res != AXDR_SUCCESS) return res;
     memcpy(octets, codec->buffer + codec->position, len);
     codec->position += len;
+    axdr_checksum_fold(codec);
     *length = (size_t)len;
     return AXDR_SUCCESS;
 }
@@ -359,6 +514,7 @@ int axdr_encode_varbit_string(AXDR_CODEC* codec, const uint8_t* bits, size_t bit
     if (codec->position + byte_length > codec->size) return AXDR_ERROR_BUFFER_OVERFLOW;
     memcpy(codec->buffer + codec->position, bits, byte_length);
     codec->position += byte_length;
+    axdr_checksum_fold(codec);
     return AXDR_SUCCESS;
 }
 
@@ -370,8 +526,11 @@ int axdr_decode_varbit_string(AXDR_CODEC* codec, uint8_t* bits, size_t* bit_leng
     if (nbits < 0 || (size_t)nbits > max_bits) return AXDR_ERROR_CONSTRAINT;
     size_t byte_length = ((size_t)nbits + 7) / 8;
     if (codec->position + byte_length > codec->size) return AXDR_ERROR_BUFFER_OVERFLOW;
+    res = axdr_budget_output(codec, byte_length);
+    if (res != AXDR_SUCCESS) return res;
     memcpy(bits, codec->buffer + codec->position, byte_length);
     codec->position += byte_length;
+    axdr_checksum_fold(codec);
     *bit_length = (size_t)nbits;
     return AXDR_SUCCESS;
 }
@@ -5,6 +5,10 @@
 #include <stdbool.h>
 #include <time.h>
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 // 基本数据类型定义
 typedef uint8_t  AXDR_UINT8;
 typedef uint16_t AXDR_UINT16;
@@ -26,12 +30,31 @@ typedef struct {
     size_t maxCount;     // 最大元素个数
 } AXDR_SEQUENCE_OF;
 
+// 解码资源预算：限制单次解码（通常为一帧）消耗的资源，防止恶意长度或元素个数
+// 使工作线程拷贝大量数据或长时间循环。各项上限为 0 表示不限制。
+// 已用量随解码累加，失败时不回退；复用前调用 axdr_budget_reset。
+typedef struct {
+    size_t maxOutputBytes;  // 字符串类型拷贝到调用者缓冲区的总字节数
+    size_t maxElements;     // SEQUENCE OF 元素总数
+    size_t maxDepth;        // SEQUENCE / SEQUENCE OF 嵌套深度
+    size_t maxWork;         // 工作量：每个 SEQUENCE 字段或 SEQUENCE OF 元素计 1
+    size_t outputBytes;
+    size_t elements;
+    size_t depth;
+    size_t work;
+} AXDR_DECODE_BUDGET;
+
 // 编码上下文结构
 typedef struct {
     uint8_t* buffer;     // 编码缓冲区
     size_t   size;       // 缓冲区大小
     size_t   position;   // 当前位置
     int      error;      // 错误码
+    size_t   errorOffset; // 出错位置：解码时为缓冲区偏移，编码时为输入中的偏移
+    int      checksumType; // 校验模式（axdr_crc.h），默认不计算
+    uint32_t checksum;     // 截至 checksumMark 的 CRC 中间值
+    size_t   checksumMark; // 已计入 CRC 的位置
+    AXDR_DECODE_BUDGET* budget; // 解码预算，NULL 表示不限制
 } AXDR_CODEC;
 
 // 编码参数结构
@@ -47,37 +70,74 @@ typedef struct {
 #define AXDR_ERROR_INVALID_VALUE    -3
 #define AXDR_ERROR_CONSTRAINT       -4
 #define AXDR_ERROR_INVALID_TYPE     -5
+#define AXDR_ERROR_CHECKSUM         -6
+#define AXDR_ERROR_LAYOUT_CHANGED   -7
+#define AXDR_ERROR_BUDGET           -8
 
-// 编码函数声明
+// 校验模式（axdr_crc.h）下把 [checksumMark, position) 计入 CRC
+int axdr_codec_checksum_update(AXDR_CODEC* codec);
+
+// 编解码函数前移 position 后调用：开启校验时趁刚访问过的字节仍在缓存中计入 CRC
+static inline void axdr_checksum_fold(AXDR_CODEC* codec) {
+    if (codec->checksumType != 0) {
+        axdr_codec_checksum_update(codec);
+    }
+}
+
+// 定长基本类型编解码函数
+// 定义 AXDR_INLINE_PRIMITIVES 时以 static inline 形式提供（见 axdr_inline.h）
+#ifdef AXDR_INLINE_PRIMITIVES
+#define AXDR_PRIMITIVE static inline
+#include "axdr_inline.h"
+#else
 int axdr_encode_integer(AXDR_CODEC* codec, int32_t value, int32_t min, int32_t max);
 int axdr_encode_unsigned(AXDR_CODEC* codec, uint32_t value, uint32_t max);
 int axdr_encode_boolean(AXDR_CODEC* codec, bool value);
 int axdr_encode_enum(AXDR_CODEC* codec, int value, int count);
+int axdr_encode_null(AXDR_CODEC* codec);
+int axdr_encode_varint(AXDR_CODEC* codec, int32_t value);
+int axdr_decode_integer(AXDR_CODEC* codec, int32_t* value, int32_t min, int32_t max);
+int axdr_decode_unsigned(AXDR_CODEC* codec, uint32_t* value, uint32_t max);
+int axdr_decode_boolean(AXDR_CODEC* codec, bool* value);
+int axdr_decode_enum(AXDR_CODEC* codec, int* value, int count);
+int axdr_decode_null(AXDR_CODEC* codec);
+int axdr_decode_varint(AXDR_CODEC* codec, int32_t* value);
+#endif
+
+// 编码函数声明
 int axdr_encode_bit_string(AXDR_CODEC* codec, const uint8_t* bits, size_t length);
 int axdr_encode_octet_string(AXDR_CODEC* codec, const uint8_t* octets, size_t length);
 int axdr_encode_visible_string(AXDR_CODEC* codec, const char* str, size_t max_length);
 int axdr_encode_generalized_time(AXDR_CODEC* codec, time_t time);
-int axdr_encode_null(AXDR_CODEC* codec);
-int axdr_encode_varint(AXDR_CODEC* codec, int32_t value);
 int axdr_encode_varoctet_string(AXDR_CODEC* codec, const uint8_t* octets, size_t length);
 int axdr_encode_varvisible_string(AXDR_CODEC* codec, const char* str);
 int axdr_encode_varbit_string(AXDR_CODEC* codec, const uint8_t* bits, size_t bit_length);
 
 // 解码函数声明
-int axdr_decode_integer(AXDR_CODEC* codec, int32_t* value, int32_t min, int32_t max);
-int axdr_decode_unsigned(AXDR_CODEC* codec, uint32_t* value, uint32_t max);
-int axdr_decode_boolean(AXDR_CODEC* codec, bool* value);
-int axdr_decode_enum(AXDR_CODEC* codec, int* value, int count);
 int axdr_decode_bit_string(AXDR_CODEC* codec, uint8_t* bits, size_t* length);
 int axdr_decode_octet_string(AXDR_CODEC* codec, uint8_t* octets, size_t* length);
 int axdr_decode_visible_string(AXDR_CODEC* codec, char* str, size_t max_length);
 int axdr_decode_generalized_time(AXDR_CODEC* codec, time_t* time);
-int axdr_decode_null(AXDR_CODEC* codec);
-int axdr_decode_varint(AXDR_CODEC* codec, int32_t* value);
 int axdr_decode_varoctet_string(AXDR_CODEC* codec, uint8_t* octets, size_t* length, size_t max_length);
 int axdr_decode_varvisible_string(AXDR_CODEC* codec, char* str, size_t* length, size_t max_length);
 int axdr_decode_varbit_string(AXDR_CODEC* codec, uint8_t* bits, size_t* bit_length, size_t max_bits);
 
+// VisibleString 内容校验（0x20-0x7E），dst 非 NULL 时同时拷贝。返回第一个非法字节的偏移，
+// 全部合法时返回 length。VisibleString 的各条解码路径（含模式遍历与导出）共用，出错时
+// 都返回 AXDR_ERROR_INVALID_VALUE，errorOffset 为该字节在缓冲区中的偏移。
+// 可变长度可视串只有长度约束，各条路径都不校验字符范围
+size_t axdr_visible_copy(const uint8_t* src, size_t length, uint8_t* dst);
+
+// 浮点数（IEEE 754，float32 4 字节 / float64 8 字节，高字节在前），NaN 与无穷原样传递
+int axdr_encode_float32(AXDR_CODEC* codec, float value);
+int axdr_encode_float64(AXDR_CODEC* codec, double value);
+int axdr_decode_float32(AXDR_CODEC* codec, float* value);
+int axdr_decode_float64(AXDR_CODEC* codec, double* value);
+
+// 按目标缓冲区容量解码：长度超过容量时在拷贝前返回 AXDR_ERROR_CONSTRAINT，position 不变
+int axdr_decode_octet_string_bounded(AXDR_CODEC* codec, uint8_t* octets, size_t capacity, size_t* length);
+int axdr_decode_bit_string_bounded(AXDR_CODEC* codec, uint8_t* bits, size_t capacityBits, size_t* length);
+
 // SEQUENCE编解码函数类型定义
 typedef int (*AXDR_ENCODE_FIELD)(AXDR_CODEC* codec, const void* field);
 typedef int (*AXDR_DECODE_FIELD)(AXDR_CODEC* codec, void* field);
@@ -107,6 +167,23 @@ int axdr_decode_sequence_of(AXDR_CODEC* codec, AXDR_SEQUENCE_OF* sequence,
 
 // 上下文操作函数
 AXDR_CODEC* axdr_codec_init(uint8_t* buffer, size_t size);
+void axdr_codec_attach(AXDR_CODEC* codec, uint8_t* buffer, size_t size);
 void axdr_codec_cleanup(AXDR_CODEC* codec);
 
+// 解码预算
+void axdr_budget_init(AXDR_DECODE_BUDGET* budget, size_t maxOutputBytes, size_t maxElements,
+                      size_t maxDepth, size_t maxWork);
+void axdr_budget_reset(AXDR_DECODE_BUDGET* budget);
+// 计入用量，超出时返回 AXDR_ERROR_BUDGET 并记录 codec->error / errorOffset；
+// codec->budget 为 NULL 时直接返回成功
+int axdr_budget_output(AXDR_CODEC* codec, size_t bytes);
+int axdr_budget_work(AXDR_CODEC* codec, size_t units);
+int axdr_budget_elements(AXDR_CODEC* codec, size_t count);  // 同时计入等量工作量
+int axdr_budget_enter(AXDR_CODEC* codec);                    // 进入一层嵌套
+void axdr_budget_leave(AXDR_CODEC* codec);
+
+#ifdef __cplusplus
+}
+#endif
+
 #endif // AXDR_H
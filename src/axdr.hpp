@@ -0,0 +1,414 @@
+#ifndef AXDR_HPP
+#define AXDR_HPP
+
+// C++17 前端（仅头文件）
+//
+// 结构体通过 constexpr 字段列表声明各字段的 A-XDR 类型与约束，axdr::encode<T> /
+// axdr::decode<T> 在编译期展开为逐字段的基本类型调用，约束作为模板参数成为常量。
+// 不经过 void* 回调，也不构造 AXDR_ENCODE_PARAMS 数组。
+//
+//   struct Reading {
+//       int32_t          value;
+//       std::string_view meter;
+//       static constexpr auto axdr_fields() {
+//           return axdr::fields(axdr::field<&Reading::value, axdr::integer<-1000, 1000>>{},
+//                               axdr::field<&Reading::meter, axdr::visible_string<16>>{});
+//       }
+//   };
+//
+// 字节串和可视串可解码为 axdr::span<const uint8_t> / std::string_view，直接指向
+// 解码缓冲区（零拷贝），缓冲区有效期内可用；也可解码为 std::vector / std::string。
+
+#include "axdr.h"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#if __has_include(<span>) && __cplusplus > 201703L
+#include <span>
+#endif
+
+// 定长基本类型：库未以内联方式构建时，在命名空间内以其他名字另外包含一份 static inline
+// 实现，保证 C++ 调用处总能内联并折叠常量约束（改名以免与 C 函数经参数依赖查找产生二义性）
+namespace axdr {
+namespace detail {
+#ifndef AXDR_INLINE_PRIMITIVES
+#define axdr_encode_integer inline_encode_integer
+#define axdr_encode_unsigned inline_encode_unsigned
+#define axdr_encode_boolean inline_encode_boolean
+#define axdr_encode_enum inline_encode_enum
+#define axdr_encode_null inline_encode_null
+#define axdr_encode_varint inline_encode_varint
+#define axdr_decode_integer inline_decode_integer
+#define axdr_decode_unsigned inline_decode_unsigned
+#define axdr_decode_boolean inline_decode_boolean
+#define axdr_decode_enum inline_decode_enum
+#define axdr_decode_null inline_decode_null
+#define axdr_decode_varint inline_decode_varint
+#define AXDR_PRIMITIVE static inline
+#include "axdr_inline.h"
+#undef AXDR_PRIMITIVE
+#undef axdr_encode_integer
+#undef axdr_encode_unsigned
+#undef axdr_encode_boolean
+#undef axdr_encode_enum
+#undef axdr_encode_null
+#undef axdr_encode_varint
+#undef axdr_decode_integer
+#undef axdr_decode_unsigned
+#undef axdr_decode_boolean
+#undef axdr_decode_enum
+#undef axdr_decode_null
+#undef axdr_decode_varint
+#else
+constexpr auto& inline_encode_integer = ::axdr_encode_integer;
+constexpr auto& inline_encode_unsigned = ::axdr_encode_unsigned;
+constexpr auto& inline_encode_boolean = ::axdr_encode_boolean;
+constexpr auto& inline_encode_enum = ::axdr_encode_enum;
+constexpr auto& inline_encode_null = ::axdr_encode_null;
+constexpr auto& inline_encode_varint = ::axdr_encode_varint;
+constexpr auto& inline_decode_integer = ::axdr_decode_integer;
+constexpr auto& inline_decode_unsigned = ::axdr_decode_unsigned;
+constexpr auto& inline_decode_boolean = ::axdr_decode_boolean;
+constexpr auto& inline_decode_enum = ::axdr_decode_enum;
+constexpr auto& inline_decode_null = ::axdr_decode_null;
+constexpr auto& inline_decode_varint = ::axdr_decode_varint;
+#endif
+} // namespace detail
+
+// 连续内存视图：C++20 下即 std::span，C++17 下提供相同用法的最小实现
+#if defined(__cpp_lib_span)
+template <typename T>
+using span = std::span<T>;
+#else
+template <typename T>
+class span {
+public:
+    constexpr span() noexcept : data_(nullptr), size_(0) {}
+    constexpr span(T* data, std::size_t size) noexcept : data_(data), size_(size) {}
+    template <typename C, typename = decltype(std::declval<C&>().data())>
+    constexpr span(C& container) noexcept : data_(container.data()), size_(container.size()) {}
+
+    constexpr T* data() const noexcept { return data_; }
+    constexpr std::size_t size() const noexcept { return size_; }
+    constexpr bool empty() const noexcept { return size_ == 0; }
+    constexpr T* begin() const noexcept { return data_; }
+    constexpr T* end() const noexcept { return data_ + size_; }
+    constexpr T& operator[](std::size_t i) const noexcept { return data_[i]; }
+
+private:
+    T*          data_;
+    std::size_t size_;
+};
+#endif
+
+// 字段声明
+template <auto Member, typename Codec>
+struct field {};
+
+template <typename... Fields>
+constexpr std::tuple<Fields...> fields(Fields...) noexcept {
+    return {};
+}
+
+// 基本类型
+template <int32_t Min = INT32_MIN, int32_t Max = INT32_MAX>
+struct integer {
+    static int encode(AXDR_CODEC& codec, int32_t value) {
+        return detail::inline_encode_integer(&codec, value, Min, Max);
+    }
+    static int decode(AXDR_CODEC& codec, int32_t& value) {
+        return detail::inline_decode_integer(&codec, &value, Min, Max);
+    }
+};
+
+template <uint32_t Max = UINT32_MAX>
+struct unsigned_integer {
+    static int encode(AXDR_CODEC& codec, uint32_t value) {
+        return detail::inline_encode_unsigned(&codec, value, Max);
+    }
+    static int decode(AXDR_CODEC& codec, uint32_t& value) {
+        return detail::inline_decode_unsigned(&codec, &value, Max);
+    }
+};
+
+struct boolean {
+    static int encode(AXDR_CODEC& codec, bool value) {
+        return detail::inline_encode_boolean(&codec, value);
+    }
+    static int decode(AXDR_CODEC& codec, bool& value) {
+        return detail::inline_decode_boolean(&codec, &value);
+    }
+};
+
+// 枚举：成员可以是 int 或 enum / enum class
+template <int Count>
+struct enumerated {
+    template <typename E>
+    static int encode(AXDR_CODEC& codec, E value) {
+        return detail::inline_encode_enum(&codec, static_cast<int>(value), Count);
+    }
+    template <typename E>
+    static int decode(AXDR_CODEC& codec, E& value) {
+        int decoded;
+        int result = detail::inline_decode_enum(&codec, &decoded, Count);
+        if (result == AXDR_SUCCESS) {
+            value = static_cast<E>(decoded);
+        }
+        return result;
+    }
+};
+
+struct varint {
+    static int encode(AXDR_CODEC& codec, int32_t value) {
+        return detail::inline_encode_varint(&codec, value);
+    }
+    static int decode(AXDR_CODEC& codec, int32_t& value) {
+        return detail::inline_decode_varint(&codec, &value);
+    }
+};
+
+struct float32 {
+    static int encode(AXDR_CODEC& codec, float value) {
+        return axdr_encode_float32(&codec, value);
+    }
+    static int decode(AXDR_CODEC& codec, float& value) {
+        return axdr_decode_float32(&codec, &value);
+    }
+};
+
+struct float64 {
+    static int encode(AXDR_CODEC& codec, double value) {
+        return axdr_encode_float64(&codec, value);
+    }
+    static int decode(AXDR_CODEC& codec, double& value) {
+        return axdr_decode_float64(&codec, &value);
+    }
+};
+
+namespace detail {
+// 读取 4 字节长度前缀并取得内容所在位置，失败时 position 不变
+template <std::size_t MaxLength>
+inline int take(AXDR_CODEC& codec, const uint8_t*& data, std::size_t& length) {
+    std::size_t start = codec.position;
+    uint32_t value;
+    int result = inline_decode_unsigned(&codec, &value, UINT32_MAX);
+    if (result != AXDR_SUCCESS) {
+        return result;
+    }
+    if (value > MaxLength) {
+        codec.position = start;
+        return AXDR_ERROR_CONSTRAINT;
+    }
+    if (value > codec.size - codec.position) {
+        codec.position = start;
+        return AXDR_ERROR_BUFFER_OVERFLOW;
+    }
+    data = codec.buffer + codec.position;
+    length = value;
+    codec.position += value;
+    axdr_checksum_fold(&codec);
+    return AXDR_SUCCESS;
+}
+
+template <std::size_t MaxLength>
+inline int put(AXDR_CODEC& codec, const uint8_t* data, std::size_t length) {
+    if (length > MaxLength) {
+        return AXDR_ERROR_CONSTRAINT;
+    }
+    if (codec.position + 4 + length > codec.size) {
+        return AXDR_ERROR_BUFFER_OVERFLOW;
+    }
+    inline_encode_unsigned(&codec, static_cast<uint32_t>(length), UINT32_MAX);
+    std::memcpy(codec.buffer + codec.position, data, length);
+    codec.position += length;
+    axdr_checksum_fold(&codec);
+    return AXDR_SUCCESS;
+}
+
+// 可视字符范围 0x20-0x7E，返回第一个非法字符的偏移，全部合法时返回 length
+inline std::size_t visible_prefix(const uint8_t* data, std::size_t length) {
+    for (std::size_t i = 0; i < length; i++) {
+        if (data[i] < 0x20 || data[i] > 0x7E) {
+            return i;
+        }
+    }
+    return length;
+}
+} // namespace detail
+
+template <std::size_t MaxLength = UINT32_MAX>
+struct octet_string {
+    static int encode(AXDR_CODEC& codec, span<const uint8_t> value) {
+        return detail::put<MaxLength>(codec, value.data(), value.size());
+    }
+    static int encode(AXDR_CODEC& codec, const std::vector<uint8_t>& value) {
+        return detail::put<MaxLength>(codec, value.data(), value.size());
+    }
+    // 零拷贝：指向解码缓冲区
+    static int decode(AXDR_CODEC& codec, span<const uint8_t>& value) {
+        const uint8_t* data;
+        std::size_t length;
+        int result = detail::take<MaxLength>(codec, data, length);
+        if (result == AXDR_SUCCESS) {
+            value = span<const uint8_t>(data, length);
+        }
+        return result;
+    }
+    static int decode(AXDR_CODEC& codec, std::vector<uint8_t>& value) {
+        const uint8_t* data;
+        std::size_t length;
+        int result = detail::take<MaxLength>(codec, data, length);
+        if (result == AXDR_SUCCESS && codec.budget) {
+            result = axdr_budget_output(&codec, length);
+        }
+        if (result == AXDR_SUCCESS) {
+            value.assign(data, data + length);
+        }
+        return result;
+    }
+};
+
+template <std::size_t MaxLength = UINT32_MAX>
+struct visible_string {
+    static int encode(AXDR_CODEC& codec, std::string_view value) {
+        const uint8_t* data = reinterpret_cast<const uint8_t*>(value.data());
+        std::size_t valid = detail::visible_prefix(data, value.size());
+        if (valid != value.size()) {
+            codec.error = AXDR_ERROR_INVALID_VALUE;
+            codec.errorOffset = valid;
+            return AXDR_ERROR_INVALID_VALUE;
+        }
+        return detail::put<MaxLength>(codec, data, value.size());
+    }
+    // 零拷贝：指向解码缓冲区，不以 '\0' 结尾
+    static int decode(AXDR_CODEC& codec, std::string_view& value) {
+        std::size_t start = codec.position;
+        const uint8_t* data;
+        std::size_t length;
+        int result = detail::take<MaxLength>(codec, data, length);
+        if (result != AXDR_SUCCESS) {
+            return result;
+        }
+        std::size_t valid = detail::visible_prefix(data, length);
+        if (valid != length) {
+            codec.error = AXDR_ERROR_INVALID_VALUE;
+            codec.errorOffset = static_cast<std::size_t>(data - codec.buffer) + valid;
+            codec.position = start;
+            return AXDR_ERROR_INVALID_VALUE;
+        }
+        value = std::string_view(reinterpret_cast<const char*>(data), length);
+        return AXDR_SUCCESS;
+    }
+    static int decode(AXDR_CODEC& codec, std::string& value) {
+        std::string_view view;
+        int result = decode(codec, view);
+        if (result == AXDR_SUCCESS && codec.budget) {
+            result = axdr_budget_output(&codec, view.size());
+        }
+        if (result == AXDR_SUCCESS) {
+            value.assign(view.data(), view.size());
+        }
+        return result;
+    }
+};
+
+// 嵌套结构体：T 需提供 static constexpr axdr_fields()
+template <typename T>
+struct sequence;
+
+// SEQUENCE OF：成员为 std::vector，Element 为元素的编解码类型
+template <std::size_t MaxCount, typename Element>
+struct sequence_of {
+    template <typename V>
+    static int encode(AXDR_CODEC& codec, const std::vector<V>& value) {
+        if (value.size() > MaxCount) {
+            return AXDR_ERROR_CONSTRAINT;
+        }
+        int result = detail::inline_encode_unsigned(&codec, static_cast<uint32_t>(value.size()),
+                                                  static_cast<uint32_t>(MaxCount));
+        for (std::size_t i = 0; i < value.size() && result == AXDR_SUCCESS; i++) {
+            result = Element::encode(codec, value[i]);
+        }
+        return result;
+    }
+    template <typename V>
+    static int decode(AXDR_CODEC& codec, std::vector<V>& value) {
+        uint32_t count;
+        int result = detail::inline_decode_unsigned(&codec, &count, static_cast<uint32_t>(MaxCount));
+        if (result != AXDR_SUCCESS) {
+            return result;
+        }
+        // 每个元素至少占 1 字节，防止伪造的元素个数导致过量分配
+        if (count > codec.size - codec.position) {
+            return AXDR_ERROR_BUFFER_OVERFLOW;
+        }
+        if (codec.budget) {
+            result = axdr_budget_elements(&codec, count);
+            if (result == AXDR_SUCCESS) {
+                result = axdr_budget_enter(&codec);
+            }
+            if (result != AXDR_SUCCESS) {
+                return result;
+            }
+        }
+        value.resize(count);
+        for (std::size_t i = 0; i < count && result == AXDR_SUCCESS; i++) {
+            result = Element::decode(codec, value[i]);
+        }
+        if (codec.budget) {
+            axdr_budget_leave(&codec);
+        }
+        return result;
+    }
+};
+
+namespace detail {
+template <typename T, auto Member, typename Codec>
+inline int encode_field(AXDR_CODEC& codec, const T& value, field<Member, Codec>) {
+    return Codec::encode(codec, value.*Member);
+}
+
+template <typename T, auto Member, typename Codec>
+inline int decode_field(AXDR_CODEC& codec, T& value, field<Member, Codec>) {
+    return Codec::decode(codec, value.*Member);
+}
+} // namespace detail
+
+template <typename T>
+struct sequence {
+    static int encode(AXDR_CODEC& codec, const T& value) {
+        int result = AXDR_SUCCESS;
+        std::apply([&](auto... f) {
+            (((result = detail::encode_field(codec, value, f)) == AXDR_SUCCESS) && ...);
+        }, T::axdr_fields());
+        return result;
+    }
+    static int decode(AXDR_CODEC& codec, T& value) {
+        int result = AXDR_SUCCESS;
+        std::apply([&](auto... f) {
+            (((result = detail::decode_field(codec, value, f)) == AXDR_SUCCESS) && ...);
+        }, T::axdr_fields());
+        return result;
+    }
+};
+
+// 入口
+template <typename T>
+inline int encode(AXDR_CODEC& codec, const T& value) {
+    return sequence<T>::encode(codec, value);
+}
+
+template <typename T>
+inline int decode(AXDR_CODEC& codec, T& value) {
+    return sequence<T>::decode(codec, value);
+}
+
+} // namespace axdr
+
+#endif // AXDR_HPP
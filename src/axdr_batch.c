@@ -0,0 +1,153 @@
+#include "axdr_batch.h"
+#include <string.h>
+
+static const uint8_t batch_magic[4] = {'A', 'X', 'B', 'T'};
+
+static inline uint32_t batch_load32(const uint8_t* p) {
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | (uint32_t)p[3];
+}
+
+static inline void batch_store32(uint8_t* p, uint32_t value) {
+    p[0] = (uint8_t)(value >> 24);
+    p[1] = (uint8_t)(value >> 16);
+    p[2] = (uint8_t)(value >> 8);
+    p[3] = (uint8_t)value;
+}
+
+// 写入实现
+int axdr_batch_begin(AXDR_BATCH_WRITER* writer, AXDR_CODEC* codec) {
+    if (!writer || !codec) {
+        return AXDR_ERROR_INVALID_VALUE;
+    }
+    if (codec->position + AXDR_BATCH_HEADER_SIZE > codec->size) {
+        return AXDR_ERROR_BUFFER_OVERFLOW;
+    }
+
+    memset(writer, 0, sizeof(AXDR_BATCH_WRITER));
+    writer->codec = codec;
+    writer->start = codec->position;
+    writer->checksumType = codec->checksumType;
+    codec->checksumType = 0;
+    codec->position += AXDR_BATCH_HEADER_SIZE;
+    return AXDR_SUCCESS;
+}
+
+int axdr_batch_message_begin(AXDR_BATCH_WRITER* writer) {
+    if (!writer || !writer->codec || writer->open) {
+        return AXDR_ERROR_INVALID_VALUE;
+    }
+    AXDR_CODEC* codec = writer->codec;
+    if (codec->position + 4 > codec->size) {
+        return AXDR_ERROR_BUFFER_OVERFLOW;
+    }
+
+    writer->messageStart = codec->position;
+    codec->position += 4;
+    writer->open = 1;
+    return AXDR_SUCCESS;
+}
+
+int axdr_batch_message_end(AXDR_BATCH_WRITER* writer) {
+    if (!writer || !writer->codec || !writer->open) {
+        return AXDR_ERROR_INVALID_VALUE;
+    }
+    AXDR_CODEC* codec = writer->codec;
+    size_t length = codec->position - writer->messageStart - 4;
+    if (length > UINT32_MAX || writer->count == UINT32_MAX) {
+        return AXDR_ERROR_INVALID_LENGTH;
+    }
+
+    batch_store32(codec->buffer + writer->messageStart, (uint32_t)length);
+    writer->count++;
+    writer->open = 0;
+    return AXDR_SUCCESS;
+}
+
+int axdr_batch_add(AXDR_BATCH_WRITER* writer, const uint8_t* message, size_t length) {
+    if (!writer || !writer->codec || writer->open || (!message && length > 0)) {
+        return AXDR_ERROR_INVALID_VALUE;
+    }
+    if (length > UINT32_MAX || writer->count == UINT32_MAX) {
+        return AXDR_ERROR_INVALID_LENGTH;
+    }
+    int result = axdr_encode_octet_string(writer->codec, message, length);
+    if (result == AXDR_SUCCESS) {
+        writer->count++;
+    }
+    return result;
+}
+
+int axdr_batch_end(AXDR_BATCH_WRITER* writer) {
+    if (!writer || !writer->codec || writer->open) {
+        return AXDR_ERROR_INVALID_VALUE;
+    }
+    AXDR_CODEC* codec = writer->codec;
+    size_t payload = codec->position - writer->start - AXDR_BATCH_HEADER_SIZE;
+    if (payload > UINT32_MAX) {
+        return AXDR_ERROR_INVALID_LENGTH;
+    }
+
+    uint8_t* header = codec->buffer + writer->start;
+    memcpy(header, batch_magic, 4);
+    batch_store32(header + 4, writer->count);
+    batch_store32(header + 8, (uint32_t)payload);
+    codec->checksumType = writer->checksumType;
+    axdr_checksum_fold(codec);
+    writer->codec = NULL;
+    return AXDR_SUCCESS;
+}
+
+// 拆分实现
+//
+// 每条消息的位置取决于前一条的长度，长度链本身只能串行遍历；
+// 循环体只有一次 4 字节读取、一次边界检查和两次存储，不解码消息内容。
+int axdr_batch_split(AXDR_CODEC* codec, AXDR_FRAME_DESC* frames, size_t maxFrames, size_t* count) {
+    if (!codec || !count || (!frames && maxFrames > 0)) {
+        return AXDR_ERROR_INVALID_VALUE;
+    }
+    if (AXDR_BATCH_HEADER_SIZE > codec->size - codec->position) {
+        return AXDR_ERROR_BUFFER_OVERFLOW;
+    }
+
+    const uint8_t* header = codec->buffer + codec->position;
+    if (memcmp(header, batch_magic, 4) != 0) {
+        return AXDR_ERROR_INVALID_VALUE;
+    }
+    uint32_t frameCount = batch_load32(header + 4);
+    uint32_t payload = batch_load32(header + 8);
+    *count = frameCount;
+    if (frameCount > maxFrames) {
+        return AXDR_ERROR_CONSTRAINT;
+    }
+    if (payload > codec->size - codec->position - AXDR_BATCH_HEADER_SIZE) {
+        return AXDR_ERROR_BUFFER_OVERFLOW;
+    }
+
+    size_t position = codec->position + AXDR_BATCH_HEADER_SIZE;
+    const size_t end = position + payload;
+    const uint8_t* buffer = codec->buffer;
+    for (uint32_t i = 0; i < frameCount; i++) {
+        if (end - position < 4) {
+            return AXDR_ERROR_INVALID_LENGTH;
+        }
+        size_t length = batch_load32(buffer + position);
+        position += 4;
+        if (length > end - position) {
+            return AXDR_ERROR_INVALID_LENGTH;
+        }
+        frames[i].offset = position;
+        frames[i].length = length;
+        position += length;
+    }
+    // 消息区必须恰好被消息填满
+    if (position != end) {
+        return AXDR_ERROR_INVALID_LENGTH;
+    }
+
+    codec->position = end;
+    return AXDR_SUCCESS;
+}
+
+void axdr_batch_frame_codec(const AXDR_CODEC* batch, const AXDR_FRAME_DESC* frame, AXDR_CODEC* codec) {
+    axdr_codec_attach(codec, batch->buffer + frame->offset, frame->length);
+}
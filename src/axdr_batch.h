@@ -0,0 +1,57 @@
+#ifndef AXDR_BATCH_H
+#define AXDR_BATCH_H
+
+#include "axdr.h"
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// 多消息批量封装
+//
+// 批次头 12 字节：魔数 "AXBT"、消息个数、消息区总长度（大端序）；
+// 其后为长度前缀的消息（4 字节长度 + 消息内容，与 OCTET STRING 编码相同）。
+// 拆分时一次遍历长度链得到每条消息的 (偏移, 长度)，之后各消息可独立并行解码。
+
+#define AXDR_BATCH_HEADER_SIZE  12
+
+// 消息描述：offset 为消息内容在缓冲区中的偏移（不含长度前缀）
+typedef struct {
+    size_t offset;
+    size_t length;
+} AXDR_FRAME_DESC;
+
+// 写入器：直接在 codec 上编码
+typedef struct {
+    AXDR_CODEC* codec;
+    size_t      start;          // 批次头位置
+    size_t      messageStart;   // 当前消息长度前缀的位置
+    uint32_t    count;          // 已写入的消息个数
+    int         open;           // 正在写入一条消息
+    int         checksumType;   // 批次期间暂停的校验模式，结束时恢复
+} AXDR_BATCH_WRITER;
+
+// 开始批次：预留批次头。批次头与长度前缀要回填，codec 开启校验（axdr_crc.h）时
+// 批次期间暂停逐字段计入，axdr_batch_end 回填完成后把整批一次计入
+int axdr_batch_begin(AXDR_BATCH_WRITER* writer, AXDR_CODEC* codec);
+// 逐条写入：message_begin 预留长度，调用者在 codec 上编码消息，message_end 回填长度
+int axdr_batch_message_begin(AXDR_BATCH_WRITER* writer);
+int axdr_batch_message_end(AXDR_BATCH_WRITER* writer);
+// 写入已编码的消息
+int axdr_batch_add(AXDR_BATCH_WRITER* writer, const uint8_t* message, size_t length);
+// 结束批次：回填批次头
+int axdr_batch_end(AXDR_BATCH_WRITER* writer);
+
+// 拆分 codec 当前位置的批次，成功后 codec->position 指向批次之后
+// 消息个数超过 maxFrames 时返回 AXDR_ERROR_CONSTRAINT，*count 给出所需个数
+int axdr_batch_split(AXDR_CODEC* codec, AXDR_FRAME_DESC* frames, size_t maxFrames, size_t* count);
+
+// 在消息上建立只读解码上下文
+void axdr_batch_frame_codec(const AXDR_CODEC* batch, const AXDR_FRAME_DESC* frame, AXDR_CODEC* codec);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // AXDR_BATCH_H
@@ -0,0 +1,244 @@
+#include "axdr_bits.h"
+#include <string.h>
+
+#if defined(__x86_64__) && defined(__GNUC__)
+#define AXDR_BITS_X86 1
+#include <immintrin.h>
+#endif
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define AXDR_BITS_SWAR 1
+#endif
+
+// 8 个字节（每字节 0/1，首元素在最低字节）与 1 个高位在前的位图字节互转的乘法常量
+#define BITS_GATHER  0x8040201008040201ULL
+#define BITS_HIGH    0x8080808080808080ULL
+
+#ifdef AXDR_BITS_X86
+// AVX2：每次处理 32 个标志，返回已处理的个数
+__attribute__((target("avx2")))
+static size_t bits_pack_avx2(const bool* values, size_t count, uint8_t* bits) {
+    // 每 8 个字节组内倒序，使首元素落在 movemask 结果每字节的最高位
+    const __m256i reverse = _mm256_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8,
+                                             7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
+    const __m256i zero = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 32 <= count; i += 32) {
+        __m256i v = _mm256_loadu_si256((const __m256i*)(values + i));
+        v = _mm256_shuffle_epi8(v, reverse);
+        uint32_t mask = ~(uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, zero));
+        memcpy(bits + i / 8, &mask, 4);
+    }
+    return i;
+}
+
+__attribute__((target("avx2")))
+static size_t bits_unpack_avx2(const uint8_t* bits, size_t count, bool* values) {
+    // 第 k 个输出字节取位图第 k / 8 字节，再用对应位选择
+    const __m256i spread = _mm256_setr_epi8(0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+                                            2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3);
+    const __m256i select = _mm256_set1_epi64x(0x0102040810204080LL);
+    const __m256i one = _mm256_set1_epi8(1);
+    size_t i = 0;
+    for (; i + 32 <= count; i += 32) {
+        uint32_t word;
+        memcpy(&word, bits + i / 8, 4);
+        __m256i v = _mm256_shuffle_epi8(_mm256_set1_epi32((int)word), spread);
+        v = _mm256_cmpeq_epi8(_mm256_and_si256(v, select), select);
+        _mm256_storeu_si256((__m256i*)(values + i), _mm256_and_si256(v, one));
+    }
+    return i;
+}
+#endif
+
+void axdr_bool_pack(const bool* values, size_t count, uint8_t* bits) {
+    size_t i = 0;
+#ifdef AXDR_BITS_X86
+    if (__builtin_cpu_supports("avx2")) {
+        i = bits_pack_avx2(values, count, bits);
+    }
+#endif
+#ifdef AXDR_BITS_SWAR
+    for (; i + 8 <= count; i += 8) {
+        uint64_t word;
+        memcpy(&word, values + i, 8);
+        bits[i / 8] = (uint8_t)((word * BITS_GATHER) >> 56);
+    }
+#endif
+    // 剩余不足一字节（或无 SWAR 时全部）逐位处理，多余位补 0
+    for (; i < count; i++) {
+        if (i % 8 == 0) {
+            bits[i / 8] = 0;
+        }
+        if (values[i]) {
+            bits[i / 8] |= (uint8_t)(0x80 >> (i % 8));
+        }
+    }
+}
+
+void axdr_bool_unpack(const uint8_t* bits, size_t count, bool* values) {
+    size_t i = 0;
+#ifdef AXDR_BITS_X86
+    if (__builtin_cpu_supports("avx2")) {
+        i = bits_unpack_avx2(bits, count, values);
+    }
+#endif
+#ifdef AXDR_BITS_SWAR
+    for (; i + 8 <= count; i += 8) {
+        uint64_t word = ((bits[i / 8] * BITS_GATHER) & BITS_HIGH) >> 7;
+        memcpy(values + i, &word, 8);
+    }
+#endif
+    for (; i < count; i++) {
+        values[i] = (bits[i / 8] >> (7 - i % 8)) & 1;
+    }
+}
+
+// 编解码实现
+int axdr_encode_boolean_array(AXDR_CODEC* codec, const bool* values, size_t count) {
+    if (!codec || (!values && count > 0)) {
+        return AXDR_ERROR_INVALID_VALUE;
+    }
+    if (count > UINT32_MAX) {
+        return AXDR_ERROR_CONSTRAINT;
+    }
+    size_t byte_length = (count + 7) / 8;
+    if (codec->position + 4 + byte_length > codec->size) {
+        return AXDR_ERROR_BUFFER_OVERFLOW;
+    }
+
+    axdr_encode_unsigned(codec, (uint32_t)count, UINT32_MAX);
+    axdr_bool_pack(values, count, codec->buffer + codec->position);
+    codec->position += byte_length;
+    axdr_checksum_fold(codec);
+    return AXDR_SUCCESS;
+}
+
+int axdr_decode_bitmap(AXDR_CODEC* codec, AXDR_BITMAP* bitmap, size_t maxBits) {
+    if (!codec || !bitmap) {
+        return AXDR_ERROR_INVALID_VALUE;
+    }
+
+    size_t start = codec->position;
+    uint32_t bit_length;
+    int result = axdr_decode_unsigned(codec, &bit_length, UINT32_MAX);
+    if (result != AXDR_SUCCESS) {
+        return result;
+    }
+    if (bit_length > maxBits) {
+        codec->position = start;
+        return AXDR_ERROR_CONSTRAINT;
+    }
+
+    size_t byte_length = ((size_t)bit_length + 7) / 8;
+    if (byte_length > codec->size - codec->position) {
+        codec->position = start;
+        return AXDR_ERROR_BUFFER_OVERFLOW;
+    }
+
+    bitmap->bits = codec->buffer + codec->position;
+    bitmap->length = bit_length;
+    codec->position += byte_length;
+    axdr_checksum_fold(codec);
+    return AXDR_SUCCESS;
+}
+
+int axdr_decode_boolean_array(AXDR_CODEC* codec, bool* values, size_t* count, size_t maxCount) {
+    if (!values || !count) {
+        return AXDR_ERROR_INVALID_VALUE;
+    }
+    size_t start = codec->position;
+    AXDR_BITMAP bitmap;
+    int result = axdr_decode_bitmap(codec, &bitmap, maxCount);
+    if (result == AXDR_SUCCESS) {
+        result = axdr_budget_output(codec, bitmap.length);
+    }
+    if (result != AXDR_SUCCESS) {
+        codec->position = start;
+        return result;
+    }
+    axdr_bool_unpack(bitmap.bits, bitmap.length, values);
+    *count = bitmap.length;
+    return AXDR_SUCCESS;
+}
+
+// 末字节中有效位的掩码，整字节时为 0xFF
+static inline uint8_t bitmap_tail_mask(size_t length) {
+    return (uint8_t)(0xFF << ((8 - length % 8) % 8));
+}
+
+size_t axdr_bitmap_popcount(const AXDR_BITMAP* bitmap) {
+    if (!bitmap || bitmap->length == 0) {
+        return 0;
+    }
+
+    size_t bytes = (bitmap->length + 7) / 8;
+    size_t total = 0;
+    size_t i = 0;
+    for (; i + 8 < bytes; i += 8) {
+        uint64_t word;
+        memcpy(&word, bitmap->bits + i, 8);
+        total += (size_t)__builtin_popcountll(word);
+    }
+    for (; i + 1 < bytes; i++) {
+        total += (size_t)__builtin_popcount(bitmap->bits[i]);
+    }
+    // 末字节只统计有效位
+    total += (size_t)__builtin_popcount(bitmap->bits[bytes - 1] & bitmap_tail_mask(bitmap->length));
+    return total;
+}
+
+bool axdr_bitmap_any(const AXDR_BITMAP* bitmap) {
+    if (!bitmap || bitmap->length == 0) {
+        return false;
+    }
+
+    size_t bytes = (bitmap->length + 7) / 8;
+    size_t i = 0;
+    for (; i + 8 < bytes; i += 8) {
+        uint64_t word;
+        memcpy(&word, bitmap->bits + i, 8);
+        if (word) {
+            return true;
+        }
+    }
+    for (; i + 1 < bytes; i++) {
+        if (bitmap->bits[i]) {
+            return true;
+        }
+    }
+    return (bitmap->bits[bytes - 1] & bitmap_tail_mask(bitmap->length)) != 0;
+}
+
+bool axdr_bitmap_all(const AXDR_BITMAP* bitmap) {
+    if (!bitmap) {
+        return false;
+    }
+    if (bitmap->length == 0) {
+        return true;
+    }
+
+    size_t bytes = (bitmap->length + 7) / 8;
+    size_t i = 0;
+    for (; i + 8 < bytes; i += 8) {
+        uint64_t word;
+        memcpy(&word, bitmap->bits + i, 8);
+        if (word != UINT64_MAX) {
+            return false;
+        }
+    }
+    for (; i + 1 < bytes; i++) {
+        if (bitmap->bits[i] != 0xFF) {
+            return false;
+        }
+    }
+    uint8_t mask = bitmap_tail_mask(bitmap->length);
+    return (bitmap->bits[bytes - 1] & mask) == mask;
+}
+
+bool axdr_bitmap_get(const AXDR_BITMAP* bitmap, size_t index) {
+    if (!bitmap || index >= bitmap->length) {
+        return false;
+    }
+    return (bitmap->bits[index / 8] >> (7 - index % 8)) & 1;
+}
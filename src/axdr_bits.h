@@ -0,0 +1,45 @@
+#ifndef AXDR_BITS_H
+#define AXDR_BITS_H
+
+#include "axdr.h"
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// 压缩布尔数组
+//
+// bool[] 与位图互相转换，每个标志只占 1 位。线上格式与 BIT STRING 相同：
+// 4 字节位数 + 按字节打包的位，每字节高位在前，末字节多余的位补 0。
+// x86-64 上运行时检测到 AVX2 时用比较 + movemask 打包、字节重排展开，
+// 其他情况每 8 个标志用一次乘法完成打包或展开。
+
+// 位图只读视图，指向编码缓冲区或调用者的数组
+typedef struct {
+    const uint8_t* bits;
+    size_t         length;      // 位数
+} AXDR_BITMAP;
+
+// 打包：bits 至少 (count + 7) / 8 字节
+void axdr_bool_pack(const bool* values, size_t count, uint8_t* bits);
+// 展开：values 至少 count 个元素
+void axdr_bool_unpack(const uint8_t* bits, size_t count, bool* values);
+
+// 编解码
+int axdr_encode_boolean_array(AXDR_CODEC* codec, const bool* values, size_t count);
+int axdr_decode_boolean_array(AXDR_CODEC* codec, bool* values, size_t* count, size_t maxCount);
+// 零拷贝解码：bitmap 指向 codec 缓冲区，codec 有效期内可用
+int axdr_decode_bitmap(AXDR_CODEC* codec, AXDR_BITMAP* bitmap, size_t maxBits);
+
+// 直接在位图上查询
+size_t axdr_bitmap_popcount(const AXDR_BITMAP* bitmap);
+bool axdr_bitmap_any(const AXDR_BITMAP* bitmap);
+bool axdr_bitmap_all(const AXDR_BITMAP* bitmap);
+bool axdr_bitmap_get(const AXDR_BITMAP* bitmap, size_t index);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // AXDR_BITS_H
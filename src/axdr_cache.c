@@ -0,0 +1,243 @@
+#include "axdr_cache.h"
+#include "axdr_hash.h"
+#include <limits.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef int (*CACHE_ENCODER)(AXDR_CODEC* codec, const void* ctx);
+
+// 线程到分片的映射：线程首次使用缓存时按轮转分配
+static atomic_uint cacheNextShard;
+static _Thread_local unsigned cacheThreadShard = UINT_MAX;
+
+static AXDR_ENCODE_CACHE_SHARD* cache_shard(AXDR_ENCODE_CACHE* cache) {
+    unsigned index = cacheThreadShard;
+    if (index == UINT_MAX) {
+        index = cacheThreadShard = atomic_fetch_add(&cacheNextShard, 1);
+    }
+    return &cache->shards[index % cache->shardCount];
+}
+
+AXDR_ENCODE_CACHE* axdr_encode_cache_create(size_t shardCount, size_t entriesPerShard, size_t maxEntryBytes) {
+    if (shardCount == 0 || entriesPerShard == 0 || maxEntryBytes == 0) {
+        return NULL;
+    }
+
+    AXDR_ENCODE_CACHE* cache = (AXDR_ENCODE_CACHE*)calloc(1, sizeof(AXDR_ENCODE_CACHE));
+    if (!cache) {
+        return NULL;
+    }
+
+    size_t sets = 1;
+    while (sets * AXDR_ENCODE_CACHE_WAYS < entriesPerShard) {
+        sets <<= 1;
+    }
+    cache->sets = sets;
+    cache->maxEntryBytes = maxEntryBytes;
+    cache->shardCount = shardCount;
+    cache->shards = (AXDR_ENCODE_CACHE_SHARD*)calloc(shardCount, sizeof(AXDR_ENCODE_CACHE_SHARD));
+    if (!cache->shards) {
+        free(cache);
+        return NULL;
+    }
+
+    size_t entries = sets * AXDR_ENCODE_CACHE_WAYS;
+    for (size_t i = 0; i < shardCount; i++) {
+        AXDR_ENCODE_CACHE_SHARD* shard = &cache->shards[i];
+        pthread_mutex_init(&shard->lock, NULL);
+        shard->entries = (AXDR_ENCODE_CACHE_ENTRY*)calloc(entries, sizeof(AXDR_ENCODE_CACHE_ENTRY));
+        shard->slab = (uint8_t*)malloc(entries * maxEntryBytes);
+        shard->hands = (uint8_t*)calloc(sets, 1);
+        if (!shard->entries || !shard->slab || !shard->hands) {
+            cache->shardCount = i + 1;
+            axdr_encode_cache_destroy(cache);
+            return NULL;
+        }
+    }
+    return cache;
+}
+
+void axdr_encode_cache_destroy(AXDR_ENCODE_CACHE* cache) {
+    if (!cache) {
+        return;
+    }
+    for (size_t i = 0; i < cache->shardCount; i++) {
+        AXDR_ENCODE_CACHE_SHARD* shard = &cache->shards[i];
+        pthread_mutex_destroy(&shard->lock);
+        free(shard->entries);
+        free(shard->slab);
+        free(shard->hands);
+    }
+    free(cache->shards);
+    free(cache);
+}
+
+// 在组内查找，命中时拷贝编码结果；调用者持有分片锁
+static int cache_find(AXDR_ENCODE_CACHE* cache, AXDR_ENCODE_CACHE_SHARD* shard, size_t set,
+                      uint64_t hash, uint32_t schemaId, const void* key, size_t keyLength,
+                      AXDR_ENCODE_CACHE_ENTRY** found) {
+    size_t base = set * AXDR_ENCODE_CACHE_WAYS;
+    for (size_t w = 0; w < AXDR_ENCODE_CACHE_WAYS; w++) {
+        AXDR_ENCODE_CACHE_ENTRY* entry = &shard->entries[base + w];
+        const uint8_t* slot = shard->slab + (base + w) * cache->maxEntryBytes;
+        if (entry->hash == hash && entry->schemaId == schemaId && entry->keyLength == keyLength &&
+            memcmp(slot, key, keyLength) == 0) {
+            *found = entry;
+            return (int)(base + w);
+        }
+    }
+    *found = NULL;
+    return -1;
+}
+
+// CLOCK 淘汰：跳过并清除访问位，选中第一个空槽或未被访问的槽
+static size_t cache_victim(AXDR_ENCODE_CACHE_SHARD* shard, size_t set) {
+    size_t base = set * AXDR_ENCODE_CACHE_WAYS;
+    for (;;) {
+        size_t w = shard->hands[set];
+        shard->hands[set] = (uint8_t)((w + 1) % AXDR_ENCODE_CACHE_WAYS);
+        AXDR_ENCODE_CACHE_ENTRY* entry = &shard->entries[base + w];
+        if (entry->hash == 0 || !entry->referenced) {
+            return base + w;
+        }
+        entry->referenced = 0;
+    }
+}
+
+static int cache_encode(AXDR_ENCODE_CACHE* cache, AXDR_CODEC* codec, uint32_t schemaId,
+                        const void* key, size_t keyLength, CACHE_ENCODER run, const void* ctx) {
+    if (!cache || !codec || (!key && keyLength > 0)) {
+        return AXDR_ERROR_INVALID_VALUE;
+    }
+
+    uint64_t hash = axdr_hash64(key, keyLength, schemaId) | 1;
+    size_t set = (size_t)(hash >> 32) & (cache->sets - 1);
+    AXDR_ENCODE_CACHE_SHARD* shard = cache_shard(cache);
+    AXDR_ENCODE_CACHE_ENTRY* entry;
+
+    pthread_mutex_lock(&shard->lock);
+    int index = cache_find(cache, shard, set, hash, schemaId, key, keyLength, &entry);
+    if (entry) {
+        int result = AXDR_SUCCESS;
+        if (codec->position + entry->valueLength > codec->size) {
+            result = AXDR_ERROR_BUFFER_OVERFLOW;
+        } else {
+            memcpy(codec->buffer + codec->position,
+                   shard->slab + (size_t)index * cache->maxEntryBytes + keyLength, entry->valueLength);
+            codec->position += entry->valueLength;
+            entry->referenced = 1;
+        }
+        shard->stats.hits++;
+        pthread_mutex_unlock(&shard->lock);
+        if (result == AXDR_SUCCESS) {
+            axdr_checksum_fold(codec);
+        }
+        return result;
+    }
+    shard->stats.misses++;
+    pthread_mutex_unlock(&shard->lock);
+
+    // 未命中：在锁外完整编码
+    size_t start = codec->position;
+    int result = run(codec, ctx);
+    if (result != AXDR_SUCCESS) {
+        return result;
+    }
+
+    size_t valueLength = codec->position - start;
+    pthread_mutex_lock(&shard->lock);
+    if (keyLength + valueLength > cache->maxEntryBytes) {
+        shard->stats.bypasses++;
+    } else if (cache_find(cache, shard, set, hash, schemaId, key, keyLength, &entry) < 0) {
+        size_t slot = cache_victim(shard, set);
+        entry = &shard->entries[slot];
+        if (entry->hash != 0) {
+            shard->stats.evictions++;
+        }
+        uint8_t* data = shard->slab + slot * cache->maxEntryBytes;
+        memcpy(data, key, keyLength);
+        memcpy(data + keyLength, codec->buffer + start, valueLength);
+        entry->hash = hash;
+        entry->schemaId = schemaId;
+        entry->keyLength = (uint32_t)keyLength;
+        entry->valueLength = (uint32_t)valueLength;
+        entry->referenced = 0;
+        shard->stats.inserts++;
+    }
+    pthread_mutex_unlock(&shard->lock);
+    return AXDR_SUCCESS;
+}
+
+typedef struct {
+    AXDR_ENCODE_FIELD encoder;
+    const void*       value;
+} CACHE_FIELD_CTX;
+
+static int cache_run_field(AXDR_CODEC* codec, const void* ctx) {
+    const CACHE_FIELD_CTX* field = (const CACHE_FIELD_CTX*)ctx;
+    return field->encoder(codec, field->value);
+}
+
+int axdr_encode_cached(AXDR_ENCODE_CACHE* cache, AXDR_CODEC* codec, uint32_t schemaId,
+                       const void* key, size_t keyLength,
+                       AXDR_ENCODE_FIELD encoder, const void* value) {
+    if (!encoder) {
+        return AXDR_ERROR_INVALID_VALUE;
+    }
+    CACHE_FIELD_CTX ctx = {encoder, value};
+    return cache_encode(cache, codec, schemaId, key, keyLength, cache_run_field, &ctx);
+}
+
+typedef struct {
+    const AXDR_ENCODE_PARAMS* params;
+    size_t                    paramCount;
+    AXDR_FIELD_ENCODER        encoder;
+} CACHE_PARAMS_CTX;
+
+static int cache_run_params(AXDR_CODEC* codec, const void* ctx) {
+    const CACHE_PARAMS_CTX* p = (const CACHE_PARAMS_CTX*)ctx;
+    return axdr_encode_sequence_with_params(codec, p->params, p->paramCount, p->encoder);
+}
+
+int axdr_encode_sequence_with_params_cached(AXDR_ENCODE_CACHE* cache, AXDR_CODEC* codec, uint32_t schemaId,
+                                            const void* key, size_t keyLength,
+                                            const AXDR_ENCODE_PARAMS* params, size_t paramCount,
+                                            AXDR_FIELD_ENCODER encoder) {
+    if (!params || !encoder) {
+        return AXDR_ERROR_INVALID_VALUE;
+    }
+    CACHE_PARAMS_CTX ctx = {params, paramCount, encoder};
+    return cache_encode(cache, codec, schemaId, key, keyLength, cache_run_params, &ctx);
+}
+
+void axdr_encode_cache_stats(AXDR_ENCODE_CACHE* cache, AXDR_ENCODE_CACHE_STATS* stats) {
+    if (!cache || !stats) {
+        return;
+    }
+    memset(stats, 0, sizeof(*stats));
+    for (size_t i = 0; i < cache->shardCount; i++) {
+        AXDR_ENCODE_CACHE_SHARD* shard = &cache->shards[i];
+        pthread_mutex_lock(&shard->lock);
+        stats->hits += shard->stats.hits;
+        stats->misses += shard->stats.misses;
+        stats->inserts += shard->stats.inserts;
+        stats->evictions += shard->stats.evictions;
+        stats->bypasses += shard->stats.bypasses;
+        pthread_mutex_unlock(&shard->lock);
+    }
+}
+
+void axdr_encode_cache_clear(AXDR_ENCODE_CACHE* cache) {
+    if (!cache) {
+        return;
+    }
+    size_t entries = cache->sets * AXDR_ENCODE_CACHE_WAYS;
+    for (size_t i = 0; i < cache->shardCount; i++) {
+        AXDR_ENCODE_CACHE_SHARD* shard = &cache->shards[i];
+        pthread_mutex_lock(&shard->lock);
+        memset(shard->entries, 0, entries * sizeof(AXDR_ENCODE_CACHE_ENTRY));
+        memset(shard->hands, 0, cache->sets);
+        pthread_mutex_unlock(&shard->lock);
+    }
+}
@@ -0,0 +1,79 @@
+#ifndef AXDR_CACHE_H
+#define AXDR_CACHE_H
+
+#include "axdr.h"
+#include <pthread.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// 编码结果缓存
+//
+// 以“模式编号 + 输入字节”为键缓存编码结果，命中时直接把缓存的字节拷贝到编码缓冲区，
+// 跳过完整的编码过程。适用于周期性重复的相同请求（按表计类别的GET请求、配置下发等）。
+//
+// 缓存按线程分片：每个线程首次使用时分配到一个分片，线程数不超过分片数时各分片互不竞争。
+// 分片内为组相联结构，每组若干路，组内按 CLOCK 算法淘汰。
+
+#define AXDR_ENCODE_CACHE_WAYS  4   // 每组的路数
+
+typedef struct {
+    uint64_t hash;          // 键哈希，0 表示空槽
+    uint32_t schemaId;
+    uint32_t keyLength;
+    uint32_t valueLength;
+    uint8_t  referenced;    // CLOCK 访问位
+} AXDR_ENCODE_CACHE_ENTRY;
+
+typedef struct {
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t inserts;
+    uint64_t evictions;
+    uint64_t bypasses;      // 键加编码结果超过单项上限而未缓存的次数
+} AXDR_ENCODE_CACHE_STATS;
+
+typedef struct {
+    pthread_mutex_t          lock;
+    AXDR_ENCODE_CACHE_ENTRY* entries;   // sets * WAYS 项
+    uint8_t*                 slab;      // 每项 maxEntryBytes 字节：键 + 编码结果
+    uint8_t*                 hands;     // 每组的 CLOCK 指针
+    AXDR_ENCODE_CACHE_STATS  stats;
+} AXDR_ENCODE_CACHE_SHARD;
+
+typedef struct {
+    AXDR_ENCODE_CACHE_SHARD* shards;
+    size_t shardCount;
+    size_t sets;            // 每个分片的组数（2的幂）
+    size_t maxEntryBytes;   // 单项（键 + 编码结果）的最大字节数
+} AXDR_ENCODE_CACHE;
+
+// entriesPerShard 向上取整为 WAYS 的倍数且组数为2的幂
+AXDR_ENCODE_CACHE* axdr_encode_cache_create(size_t shardCount, size_t entriesPerShard, size_t maxEntryBytes);
+void axdr_encode_cache_destroy(AXDR_ENCODE_CACHE* cache);
+
+// 带缓存的编码：命中时拷贝缓存的编码结果，未命中时调用 encoder(codec, value) 并缓存其输出
+// key 为决定编码结果的输入字节（例如请求参数结构体），必须完整描述 value
+int axdr_encode_cached(AXDR_ENCODE_CACHE* cache, AXDR_CODEC* codec, uint32_t schemaId,
+                       const void* key, size_t keyLength,
+                       AXDR_ENCODE_FIELD encoder, const void* value);
+
+// 带缓存的参数化SEQUENCE编码
+int axdr_encode_sequence_with_params_cached(AXDR_ENCODE_CACHE* cache, AXDR_CODEC* codec, uint32_t schemaId,
+                                            const void* key, size_t keyLength,
+                                            const AXDR_ENCODE_PARAMS* params, size_t paramCount,
+                                            AXDR_FIELD_ENCODER encoder);
+
+// 汇总所有分片的统计信息
+void axdr_encode_cache_stats(AXDR_ENCODE_CACHE* cache, AXDR_ENCODE_CACHE_STATS* stats);
+
+// 清空缓存（统计信息保留）
+void axdr_encode_cache_clear(AXDR_ENCODE_CACHE* cache);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // AXDR_CACHE_H
@@ -0,0 +1,183 @@
+#include "axdr_crc.h"
+#include <pthread.h>
+#include <string.h>
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define AXDR_CRC_SLICE8 1
+#endif
+
+// 反射多项式
+#define CRC16_X25_POLY   0x8408u
+#define CRC32_POLY       0xEDB88320u
+
+// slice-by-8 查表：table[k][b] 为字节 b 之后再经过 k 个零字节的余数
+static uint32_t crc16Table[8][256];
+static uint32_t crc32Table[8][256];
+static pthread_once_t crcTableOnce = PTHREAD_ONCE_INIT;
+
+static void crc_build_table(uint32_t table[8][256], uint32_t poly) {
+    for (uint32_t i = 0; i < 256; i++) {
+        uint32_t c = i;
+        for (int k = 0; k < 8; k++) {
+            c = (c & 1) ? poly ^ (c >> 1) : c >> 1;
+        }
+        table[0][i] = c;
+    }
+    for (int k = 1; k < 8; k++) {
+        for (uint32_t i = 0; i < 256; i++) {
+            uint32_t c = table[k - 1][i];
+            table[k][i] = (c >> 8) ^ table[0][c & 0xFF];
+        }
+    }
+}
+
+static void crc_build_tables(void) {
+    crc_build_table(crc16Table, CRC16_X25_POLY);
+    crc_build_table(crc32Table, CRC32_POLY);
+}
+
+// 反射 CRC 的通用 slice-by-8，CRC-16 与 CRC-32 共用（余数在低位）
+static uint32_t crc_slice8(uint32_t table[8][256], uint32_t crc, const uint8_t* data, size_t length) {
+    size_t i = 0;
+#ifdef AXDR_CRC_SLICE8
+    for (; i + 8 <= length; i += 8) {
+        uint64_t word;
+        memcpy(&word, data + i, 8);
+        word ^= crc;
+        crc = table[7][word & 0xFF] ^ table[6][(word >> 8) & 0xFF] ^
+              table[5][(word >> 16) & 0xFF] ^ table[4][(word >> 24) & 0xFF] ^
+              table[3][(word >> 32) & 0xFF] ^ table[2][(word >> 40) & 0xFF] ^
+              table[1][(word >> 48) & 0xFF] ^ table[0][word >> 56];
+    }
+#endif
+    for (; i < length; i++) {
+        crc = table[0][(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+    }
+    return crc;
+}
+
+uint32_t axdr_crc_init(int type) {
+    switch (type) {
+        case AXDR_CRC16_X25: return 0xFFFFu;
+        case AXDR_CRC32:     return 0xFFFFFFFFu;
+        default:             return 0;
+    }
+}
+
+uint32_t axdr_crc_update(int type, uint32_t crc, const uint8_t* data, size_t length) {
+    pthread_once(&crcTableOnce, crc_build_tables);
+    switch (type) {
+        case AXDR_CRC16_X25: return crc_slice8(crc16Table, crc, data, length);
+        case AXDR_CRC32:     return crc_slice8(crc32Table, crc, data, length);
+        default:             return crc;
+    }
+}
+
+uint32_t axdr_crc_final(int type, uint32_t crc) {
+    switch (type) {
+        case AXDR_CRC16_X25: return crc ^ 0xFFFFu;
+        case AXDR_CRC32:     return crc ^ 0xFFFFFFFFu;
+        default:             return 0;
+    }
+}
+
+size_t axdr_crc_size(int type) {
+    switch (type) {
+        case AXDR_CRC16_X25: return 2;
+        case AXDR_CRC32:     return 4;
+        default:             return 0;
+    }
+}
+
+uint16_t axdr_crc16_x25(const uint8_t* data, size_t length) {
+    uint32_t crc = axdr_crc_update(AXDR_CRC16_X25, axdr_crc_init(AXDR_CRC16_X25), data, length);
+    return (uint16_t)axdr_crc_final(AXDR_CRC16_X25, crc);
+}
+
+uint32_t axdr_crc32(const uint8_t* data, size_t length) {
+    return axdr_crc_final(AXDR_CRC32, axdr_crc_update(AXDR_CRC32, axdr_crc_init(AXDR_CRC32), data, length));
+}
+
+// 编解码上下文的校验模式
+int axdr_codec_set_checksum(AXDR_CODEC* codec, int type) {
+    if (!codec || (type != AXDR_CRC_NONE && axdr_crc_size(type) == 0)) {
+        return AXDR_ERROR_INVALID_VALUE;
+    }
+    codec->checksumType = type;
+    codec->checksum = axdr_crc_init(type);
+    codec->checksumMark = codec->position;
+    return AXDR_SUCCESS;
+}
+
+int axdr_codec_checksum_update(AXDR_CODEC* codec) {
+    if (!codec) {
+        return AXDR_ERROR_INVALID_VALUE;
+    }
+    if (codec->checksumType == AXDR_CRC_NONE) {
+        return AXDR_SUCCESS;
+    }
+    // 回退到已计入的位置之前，无法撤销；之后重写的字节也不能补算，
+    // 保持失效直到 axdr_codec_set_checksum 重新开始
+    if (codec->position < codec->checksumMark) {
+        codec->checksumMark = SIZE_MAX;
+        return AXDR_ERROR_INVALID_VALUE;
+    }
+    codec->checksum = axdr_crc_update(codec->checksumType, codec->checksum,
+                                      codec->buffer + codec->checksumMark,
+                                      codec->position - codec->checksumMark);
+    codec->checksumMark = codec->position;
+    return AXDR_SUCCESS;
+}
+
+uint32_t axdr_codec_checksum(AXDR_CODEC* codec) {
+    if (axdr_codec_checksum_update(codec) != AXDR_SUCCESS) {
+        return 0;
+    }
+    return axdr_crc_final(codec->checksumType, codec->checksum);
+}
+
+int axdr_encode_fcs(AXDR_CODEC* codec) {
+    if (!codec || codec->checksumType == AXDR_CRC_NONE) {
+        return AXDR_ERROR_INVALID_VALUE;
+    }
+    int result = axdr_codec_checksum_update(codec);
+    if (result != AXDR_SUCCESS) {
+        return result;
+    }
+    size_t size = axdr_crc_size(codec->checksumType);
+    if (codec->position + size > codec->size) {
+        return AXDR_ERROR_BUFFER_OVERFLOW;
+    }
+
+    uint32_t fcs = axdr_crc_final(codec->checksumType, codec->checksum);
+    for (size_t i = 0; i < size; i++) {
+        codec->buffer[codec->position++] = (uint8_t)(fcs >> (8 * i));
+    }
+    return axdr_codec_set_checksum(codec, codec->checksumType);
+}
+
+int axdr_decode_fcs(AXDR_CODEC* codec) {
+    if (!codec || codec->checksumType == AXDR_CRC_NONE) {
+        return AXDR_ERROR_INVALID_VALUE;
+    }
+    int result = axdr_codec_checksum_update(codec);
+    if (result != AXDR_SUCCESS) {
+        return result;
+    }
+    size_t size = axdr_crc_size(codec->checksumType);
+    if (size > codec->size - codec->position) {
+        return AXDR_ERROR_BUFFER_OVERFLOW;
+    }
+
+    uint32_t fcs = 0;
+    for (size_t i = 0; i < size; i++) {
+        fcs |= (uint32_t)codec->buffer[codec->position + i] << (8 * i);
+    }
+    if (fcs != axdr_crc_final(codec->checksumType, codec->checksum)) {
+        codec->error = AXDR_ERROR_CHECKSUM;
+        codec->errorOffset = codec->position;
+        return AXDR_ERROR_CHECKSUM;
+    }
+    codec->position += size;
+    return axdr_codec_set_checksum(codec, codec->checksumType);
+}
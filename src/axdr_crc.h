@@ -0,0 +1,60 @@
+#ifndef AXDR_CRC_H
+#define AXDR_CRC_H
+
+#include "axdr.h"
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// 帧校验序列（FCS）
+//
+// CRC-16/X.25（HDLC FCS-16）与 CRC-32（IEEE 802.3，HDLC FCS-32），按 slice-by-8 查表，
+// 每次处理 8 字节。
+//
+// 编解码上下文可开启校验模式：codec->checksumMark 记录已计入 CRC 的位置。
+// 各类型的编解码函数前移 position 后即把 [checksumMark, position) 计入 CRC，
+// 这些字节刚被访问过仍在缓存中，不必在整帧完成后再从头扫描一遍；
+// axdr_encode_fcs / axdr_decode_fcs 通常已无需补算，直接追加或核对 FCS。
+// 调用者绕过编解码函数直接读写缓冲区（如实例化模板）时，由下一次计入或 FCS 补齐，
+// 也可以自行调用 axdr_codec_checksum_update。
+// 已计入的字节不应再修改。编解码失败回退到 checksumMark 之前后校验失效，
+// 计入与 FCS 均返回 AXDR_ERROR_INVALID_VALUE，需 axdr_codec_set_checksum 重新开始。
+//
+// FCS 按 HDLC 惯例低字节在前。
+
+#define AXDR_CRC_NONE       0
+#define AXDR_CRC16_X25      1
+#define AXDR_CRC32          2
+
+// 单次计算
+uint16_t axdr_crc16_x25(const uint8_t* data, size_t length);
+uint32_t axdr_crc32(const uint8_t* data, size_t length);
+
+// 增量计算：crc 为上一次返回的中间值，首次传 axdr_crc_init 的结果，
+// 最后经 axdr_crc_final 得到 FCS
+uint32_t axdr_crc_init(int type);
+uint32_t axdr_crc_update(int type, uint32_t crc, const uint8_t* data, size_t length);
+uint32_t axdr_crc_final(int type, uint32_t crc);
+
+// FCS 字节数，type 无效时为 0
+size_t axdr_crc_size(int type);
+
+// 从当前位置开始计算 CRC，type 为 AXDR_CRC_NONE 时关闭
+int axdr_codec_set_checksum(AXDR_CODEC* codec, int type);
+// 把 [checksumMark, position) 计入 CRC（声明见 axdr.h）
+int axdr_codec_checksum_update(AXDR_CODEC* codec);
+// 截至当前位置的 FCS
+uint32_t axdr_codec_checksum(AXDR_CODEC* codec);
+
+// 追加 FCS，之后从 FCS 后开始新一帧的计算
+int axdr_encode_fcs(AXDR_CODEC* codec);
+// 核对 FCS，不符时返回 AXDR_ERROR_CHECKSUM，errorOffset 指向 FCS，position 不变
+int axdr_decode_fcs(AXDR_CODEC* codec);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // AXDR_CRC_H
@@ -0,0 +1,327 @@
+#include "axdr_datetime.h"
+
+#define SECONDS_PER_DAY  86400
+
+// 公历日期与 1970-01-01 起的日数互换（H. Hinnant 的 days_from_civil / civil_from_days），
+// 以 400 年为周期，只用整数运算
+static int64_t days_from_civil(int64_t year, unsigned month, unsigned day) {
+    year -= month <= 2;
+    int64_t era = (year >= 0 ? year : year - 399) / 400;
+    unsigned yoe = (unsigned)(year - era * 400);                                // [0, 399]
+    unsigned doy = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1; // [0, 365]
+    unsigned doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;                      // [0, 146096]
+    return era * 146097 + (int64_t)doe - 719468;
+}
+
+static void civil_from_days(int64_t days, int64_t* year, unsigned* month, unsigned* day) {
+    days += 719468;
+    int64_t era = (days >= 0 ? days : days - 146096) / 146097;
+    unsigned doe = (unsigned)(days - era * 146097);
+    unsigned yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    unsigned doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    unsigned mp = (5 * doy + 2) / 153;
+    *day = doy - (153 * mp + 2) / 5 + 1;
+    *month = mp < 10 ? mp + 3 : mp - 9;
+    *year = (int64_t)yoe + era * 400 + (*month <= 2);
+}
+
+// 1970-01-01 为星期四
+static inline uint8_t weekday_from_days(int64_t days) {
+    return (uint8_t)((days % 7 + 10) % 7 + 1);
+}
+
+// 向下取整的除法，负的时间戳也落在正确的日期上
+static inline int64_t floor_div(int64_t a, int64_t b) {
+    int64_t q = a / b;
+    return (a % b != 0 && (a < 0) != (b < 0)) ? q - 1 : q;
+}
+
+// 当月天数，年未指定时二月按 29 天
+static inline unsigned days_in_month(unsigned year, unsigned month) {
+    static const uint8_t days[12] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+    if (month == 2 && (year == AXDR_DATE_TIME_YEAR_ANY ||
+                       (year % 4 == 0 && (year % 100 != 0 || year % 400 == 0)))) {
+        return 29;
+    }
+    return days[month - 1];
+}
+
+// 校验各字段，返回第一个非法字段在编码中的字节偏移，全部合法时返回 -1
+static int date_time_invalid_offset(const AXDR_DATE_TIME* value) {
+    if (value->month != AXDR_DATE_TIME_ANY && value->month != AXDR_DATE_TIME_DST_END &&
+        value->month != AXDR_DATE_TIME_DST_BEGIN && (value->month < 1 || value->month > 12)) {
+        return 2;
+    }
+    if (value->day != AXDR_DATE_TIME_ANY && value->day != AXDR_DATE_TIME_SECOND_LAST_DAY &&
+        value->day != AXDR_DATE_TIME_LAST_DAY && (value->day < 1 || value->day > 31)) {
+        return 3;
+    }
+    // 月份已指定时日不能超过当月天数（如 02-31）
+    if (value->month >= 1 && value->month <= 12 && value->day >= 1 && value->day <= 31 &&
+        value->day > days_in_month(value->year, value->month)) {
+        return 3;
+    }
+    if (value->weekday != AXDR_DATE_TIME_ANY && (value->weekday < 1 || value->weekday > 7)) {
+        return 4;
+    }
+    if (value->hour != AXDR_DATE_TIME_ANY && value->hour > 23) {
+        return 5;
+    }
+    if (value->minute != AXDR_DATE_TIME_ANY && value->minute > 59) {
+        return 6;
+    }
+    if (value->second != AXDR_DATE_TIME_ANY && value->second > 59) {
+        return 7;
+    }
+    if (value->hundredths != AXDR_DATE_TIME_ANY && value->hundredths > 99) {
+        return 8;
+    }
+    if (value->deviation != AXDR_DATE_TIME_DEVIATION_ANY &&
+        (value->deviation < -720 || value->deviation > 720)) {
+        return 9;
+    }
+    return -1;
+}
+
+// 换算为 time_t 还要求年月日时分秒都已指定，返回第一个不满足的字段偏移或 -1
+static int date_time_unconvertible_offset(const AXDR_DATE_TIME* value) {
+    int offset = date_time_invalid_offset(value);
+    if (offset >= 0) {
+        return offset;
+    }
+    if (value->year == AXDR_DATE_TIME_YEAR_ANY) {
+        return 0;
+    }
+    if (value->month > 12) {
+        return 2;
+    }
+    if (value->day > 31) {
+        return 3;
+    }
+    if (value->hour > 23) {
+        return 5;
+    }
+    if (value->minute > 59) {
+        return 6;
+    }
+    return value->second > 59 ? 7 : -1;
+}
+
+static inline void date_time_store(uint8_t* dst, const AXDR_DATE_TIME* value) {
+    uint16_t deviation = (uint16_t)value->deviation;
+    dst[0] = (uint8_t)(value->year >> 8);
+    dst[1] = (uint8_t)value->year;
+    dst[2] = value->month;
+    dst[3] = value->day;
+    dst[4] = value->weekday;
+    dst[5] = value->hour;
+    dst[6] = value->minute;
+    dst[7] = value->second;
+    dst[8] = value->hundredths;
+    dst[9] = (uint8_t)(deviation >> 8);
+    dst[10] = (uint8_t)deviation;
+    dst[11] = value->status;
+}
+
+static inline void date_time_load(const uint8_t* src, AXDR_DATE_TIME* value) {
+    value->year = (uint16_t)((src[0] << 8) | src[1]);
+    value->month = src[2];
+    value->day = src[3];
+    value->weekday = src[4];
+    value->hour = src[5];
+    value->minute = src[6];
+    value->second = src[7];
+    value->hundredths = src[8];
+    value->deviation = (int16_t)(uint16_t)((src[9] << 8) | src[10]);
+    value->status = src[11];
+}
+
+int axdr_encode_date_time(AXDR_CODEC* codec, const AXDR_DATE_TIME* value) {
+    if (!codec || !value) {
+        return AXDR_ERROR_INVALID_VALUE;
+    }
+    if (date_time_invalid_offset(value) >= 0) {
+        return AXDR_ERROR_INVALID_VALUE;
+    }
+    if (codec->position + AXDR_DATE_TIME_SIZE > codec->size) {
+        return AXDR_ERROR_BUFFER_OVERFLOW;
+    }
+    date_time_store(codec->buffer + codec->position, value);
+    codec->position += AXDR_DATE_TIME_SIZE;
+    axdr_checksum_fold(codec);
+    return AXDR_SUCCESS;
+}
+
+int axdr_decode_date_time(AXDR_CODEC* codec, AXDR_DATE_TIME* value) {
+    if (!codec || !value) {
+        return AXDR_ERROR_INVALID_VALUE;
+    }
+    if (codec->position + AXDR_DATE_TIME_SIZE > codec->size) {
+        return AXDR_ERROR_BUFFER_OVERFLOW;
+    }
+    AXDR_DATE_TIME decoded;
+    date_time_load(codec->buffer + codec->position, &decoded);
+    int offset = date_time_invalid_offset(&decoded);
+    if (offset >= 0) {
+        codec->error = AXDR_ERROR_INVALID_VALUE;
+        codec->errorOffset = codec->position + (size_t)offset;
+        return AXDR_ERROR_INVALID_VALUE;
+    }
+    *value = decoded;
+    codec->position += AXDR_DATE_TIME_SIZE;
+    axdr_checksum_fold(codec);
+    return AXDR_SUCCESS;
+}
+
+int axdr_date_time_from_time(AXDR_DATE_TIME* value, time_t utc, int16_t deviation, uint8_t status) {
+    if (!value || (deviation != AXDR_DATE_TIME_DEVIATION_ANY && (deviation < -720 || deviation > 720))) {
+        return AXDR_ERROR_INVALID_VALUE;
+    }
+    int64_t local = (int64_t)utc - (deviation == AXDR_DATE_TIME_DEVIATION_ANY ? 0 : deviation * 60);
+    int64_t days = floor_div(local, SECONDS_PER_DAY);
+    int64_t seconds = local - days * SECONDS_PER_DAY;
+    int64_t year;
+    unsigned month, day;
+    civil_from_days(days, &year, &month, &day);
+    if (year < 0 || year >= AXDR_DATE_TIME_YEAR_ANY) {
+        return AXDR_ERROR_CONSTRAINT;
+    }
+
+    value->year = (uint16_t)year;
+    value->month = (uint8_t)month;
+    value->day = (uint8_t)day;
+    value->weekday = weekday_from_days(days);
+    value->hour = (uint8_t)(seconds / 3600);
+    value->minute = (uint8_t)(seconds / 60 % 60);
+    value->second = (uint8_t)(seconds % 60);
+    value->hundredths = 0;
+    value->deviation = deviation;
+    value->status = status;
+    return AXDR_SUCCESS;
+}
+
+int axdr_date_time_to_time(const AXDR_DATE_TIME* value, time_t* utc) {
+    if (!value || !utc || date_time_unconvertible_offset(value) >= 0) {
+        return AXDR_ERROR_INVALID_VALUE;
+    }
+    int64_t days = days_from_civil(value->year, value->month, value->day);
+    int64_t local = days * SECONDS_PER_DAY + value->hour * 3600 + value->minute * 60 + value->second;
+    int deviation = value->deviation == AXDR_DATE_TIME_DEVIATION_ANY ? 0 : value->deviation;
+    *utc = (time_t)(local + deviation * 60);
+    return AXDR_SUCCESS;
+}
+
+int axdr_encode_date_time_array(AXDR_CODEC* codec, const time_t* times, size_t count,
+                                int16_t deviation, uint8_t status) {
+    if (!codec || (!times && count > 0) || count > UINT32_MAX ||
+        (deviation != AXDR_DATE_TIME_DEVIATION_ANY && (deviation < -720 || deviation > 720))) {
+        return AXDR_ERROR_INVALID_VALUE;
+    }
+    if (codec->position + 4 > codec->size ||
+        count > (codec->size - codec->position - 4) / AXDR_DATE_TIME_SIZE) {
+        return AXDR_ERROR_BUFFER_OVERFLOW;
+    }
+
+    size_t start = codec->position;
+    axdr_encode_unsigned(codec, (uint32_t)count, UINT32_MAX);
+    uint8_t* dst = codec->buffer + codec->position;
+    int64_t offset = deviation == AXDR_DATE_TIME_DEVIATION_ANY ? 0 : deviation * 60;
+
+    // 当天的日期部分只在跨日时重新换算
+    AXDR_DATE_TIME value = {0};
+    value.deviation = deviation;
+    value.status = status;
+    int64_t dayStart = 0;
+    int64_t dayEnd = 0;
+    for (size_t i = 0; i < count; i++) {
+        int64_t local = (int64_t)times[i] - offset;
+        if (local < dayStart || local >= dayEnd) {
+            int64_t days = floor_div(local, SECONDS_PER_DAY);
+            int64_t year;
+            unsigned month, day;
+            civil_from_days(days, &year, &month, &day);
+            if (year < 0 || year >= AXDR_DATE_TIME_YEAR_ANY) {
+                codec->position = start;
+                return AXDR_ERROR_CONSTRAINT;
+            }
+            value.year = (uint16_t)year;
+            value.month = (uint8_t)month;
+            value.day = (uint8_t)day;
+            value.weekday = weekday_from_days(days);
+            dayStart = days * SECONDS_PER_DAY;
+            dayEnd = dayStart + SECONDS_PER_DAY;
+        }
+        int64_t seconds = local - dayStart;
+        value.hour = (uint8_t)(seconds / 3600);
+        value.minute = (uint8_t)(seconds / 60 % 60);
+        value.second = (uint8_t)(seconds % 60);
+        date_time_store(dst, &value);
+        dst += AXDR_DATE_TIME_SIZE;
+    }
+    codec->position += count * AXDR_DATE_TIME_SIZE;
+    axdr_checksum_fold(codec);
+    return AXDR_SUCCESS;
+}
+
+int axdr_decode_date_time_array(AXDR_CODEC* codec, time_t* times, uint8_t* status, size_t* count,
+                                size_t maxCount) {
+    if (!codec || (!times && maxCount > 0) || !count) {
+        return AXDR_ERROR_INVALID_VALUE;
+    }
+
+    size_t start = codec->position;
+    uint32_t n;
+    int result = axdr_decode_unsigned(codec, &n, maxCount > UINT32_MAX ? UINT32_MAX : (uint32_t)maxCount);
+    if (result != AXDR_SUCCESS) {
+        codec->position = start;
+        return result;
+    }
+    if (n > (codec->size - codec->position) / AXDR_DATE_TIME_SIZE) {
+        codec->position = start;
+        return AXDR_ERROR_BUFFER_OVERFLOW;
+    }
+    result = axdr_budget_elements(codec, n);
+    if (result != AXDR_SUCCESS) {
+        codec->position = start;
+        return result;
+    }
+
+    // 年月日与上一个元素相同时复用日数
+    const uint8_t* src = codec->buffer + codec->position;
+    uint32_t lastDate = UINT32_MAX;
+    int64_t days = 0;
+    for (uint32_t i = 0; i < n; i++, src += AXDR_DATE_TIME_SIZE) {
+        AXDR_DATE_TIME value;
+        date_time_load(src, &value);
+        int offset = date_time_unconvertible_offset(&value);
+        if (offset >= 0) {
+            // 无法换算为 time_t 的元素（含未指定字段）
+            codec->error = AXDR_ERROR_INVALID_VALUE;
+            codec->errorOffset = codec->position + i * AXDR_DATE_TIME_SIZE + (size_t)offset;
+            codec->position = start;
+            return AXDR_ERROR_INVALID_VALUE;
+        }
+        if (status) {
+            status[i] = value.status;
+        } else if (value.status != AXDR_DATE_TIME_ANY &&
+                   (value.status & (AXDR_CLOCK_INVALID | AXDR_CLOCK_DOUBTFUL))) {
+            // 不取时钟状态时拒绝标记为无效或可疑的时间
+            codec->error = AXDR_ERROR_INVALID_VALUE;
+            codec->errorOffset = codec->position + i * AXDR_DATE_TIME_SIZE + 11;
+            codec->position = start;
+            return AXDR_ERROR_INVALID_VALUE;
+        }
+        uint32_t date = ((uint32_t)value.year << 16) | ((uint32_t)value.month << 8) | value.day;
+        if (date != lastDate) {
+            days = days_from_civil(value.year, value.month, value.day);
+            lastDate = date;
+        }
+        int deviation = value.deviation == AXDR_DATE_TIME_DEVIATION_ANY ? 0 : value.deviation;
+        times[i] = (time_t)(days * SECONDS_PER_DAY + value.hour * 3600 + value.minute * 60 +
+                            value.second + deviation * 60);
+    }
+    codec->position += (size_t)n * AXDR_DATE_TIME_SIZE;
+    axdr_checksum_fold(codec);
+    *count = n;
+    return AXDR_SUCCESS;
+}
@@ -0,0 +1,80 @@
+#ifndef AXDR_DATETIME_H
+#define AXDR_DATETIME_H
+
+#include "axdr.h"
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// 二进制日期时间（DLMS date-time 格式，12 字节，无长度前缀）
+//
+//   year(2, 高字节在前) month day weekday hour minute second hundredths
+//   deviation(2, 有符号, 高字节在前) clockStatus
+//
+// 比 GeneralizedTime（4 字节长度 + 14 个字符）短 6 字节，解码不做字符串解析；
+// 与 time_t 的换算只用整数运算（按公历日数），不依赖 gmtime / timegm。
+//
+// deviation 为 UTC 与本地时间之差（分钟）：本地时间 = UTC - deviation，
+// 例如 UTC+1 的中欧时间为 -60。各字段可为“未指定”值。
+
+#define AXDR_DATE_TIME_SIZE           12
+
+// 未指定值
+#define AXDR_DATE_TIME_YEAR_ANY       0xFFFF
+#define AXDR_DATE_TIME_ANY            0xFF      // 月、日、星期、时、分、秒、百分秒、时钟状态
+#define AXDR_DATE_TIME_DEVIATION_ANY  ((int16_t)-32768)
+
+// 月份的特殊值
+#define AXDR_DATE_TIME_DST_END        0xFD      // 夏令时结束的月份
+#define AXDR_DATE_TIME_DST_BEGIN      0xFE      // 夏令时开始的月份
+// 日的特殊值
+#define AXDR_DATE_TIME_SECOND_LAST_DAY 0xFD
+#define AXDR_DATE_TIME_LAST_DAY        0xFE
+
+// 时钟状态位
+#define AXDR_CLOCK_INVALID            0x01      // 时间无效
+#define AXDR_CLOCK_DOUBTFUL           0x02      // 时间可疑
+#define AXDR_CLOCK_DIFFERENT_BASE     0x04      // 时钟基准与规定不同
+#define AXDR_CLOCK_STATUS_INVALID     0x08      // 状态本身无效
+#define AXDR_CLOCK_DST                0x80      // 夏令时生效
+
+typedef struct {
+    uint16_t year;
+    uint8_t  month;         // 1-12
+    uint8_t  day;           // 1-31
+    uint8_t  weekday;       // 1-7，星期一为 1
+    uint8_t  hour;
+    uint8_t  minute;
+    uint8_t  second;
+    uint8_t  hundredths;
+    int16_t  deviation;     // -720..720 分钟
+    uint8_t  status;        // AXDR_CLOCK_* 位
+} AXDR_DATE_TIME;
+
+// 单个值：字段超出范围（未指定值除外）或日超过当月天数时返回 AXDR_ERROR_INVALID_VALUE，
+// 解码失败时 position 不变，errorOffset 指向出错的字节
+int axdr_encode_date_time(AXDR_CODEC* codec, const AXDR_DATE_TIME* value);
+int axdr_decode_date_time(AXDR_CODEC* codec, AXDR_DATE_TIME* value);
+
+// 与 time_t（UTC 秒）互换。to_time 要求年月日时分秒都已指定，
+// 未指定的 deviation 按 0 处理，百分秒舍去
+int axdr_date_time_from_time(AXDR_DATE_TIME* value, time_t utc, int16_t deviation, uint8_t status);
+int axdr_date_time_to_time(const AXDR_DATE_TIME* value, time_t* utc);
+
+// 批量：SEQUENCE OF date-time（4 字节个数 + 每个 12 字节），直接与 time_t 数组互换。
+// 相邻时间戳落在同一天时复用日期换算结果（负荷曲线的常见情况）。
+// 解码时 deviation 已计入 UTC 时间；status 非 NULL 时写入各元素的时钟状态，
+// 为 NULL 时遇到标记 AXDR_CLOCK_INVALID / AXDR_CLOCK_DOUBTFUL 的元素返回
+// AXDR_ERROR_INVALID_VALUE，errorOffset 指向其时钟状态字节
+int axdr_encode_date_time_array(AXDR_CODEC* codec, const time_t* times, size_t count,
+                                int16_t deviation, uint8_t status);
+int axdr_decode_date_time_array(AXDR_CODEC* codec, time_t* times, uint8_t* status, size_t* count,
+                                size_t maxCount);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // AXDR_DATETIME_H
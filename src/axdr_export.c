@@ -0,0 +1,759 @@
+#include "axdr_export.h"
+#include "axdr_datetime.h"
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+// 两位十进制数字表，整数转文本时每次处理两位
+static const char export_digits[200] =
+    "0001020304050607080910111213141516171819"
+    "2021222324252627282930313233343536373839"
+    "4041424344454647484950515253545556575859"
+    "6061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
+static const char export_hex_digits[16] = "0123456789abcdef";
+
+int axdr_exporter_init(AXDR_EXPORTER* exporter, int format, char* out, size_t capacity, int fd) {
+    if (!exporter || !out || capacity < AXDR_EXPORT_MIN_BUFFER ||
+        (format != AXDR_EXPORT_JSON && format != AXDR_EXPORT_CSV)) {
+        return AXDR_ERROR_INVALID_VALUE;
+    }
+    memset(exporter, 0, sizeof(AXDR_EXPORTER));
+    exporter->format = format;
+    exporter->out = out;
+    exporter->capacity = capacity;
+    exporter->fd = fd;
+    return AXDR_SUCCESS;
+}
+
+int axdr_exporter_flush(AXDR_EXPORTER* exporter) {
+    if (!exporter) {
+        return AXDR_ERROR_INVALID_VALUE;
+    }
+    if (exporter->fd < 0) {
+        return AXDR_SUCCESS;
+    }
+
+    const char* data = exporter->out;
+    size_t length = exporter->length;
+    while (length > 0) {
+        ssize_t n = write(exporter->fd, data, length);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            return AXDR_ERROR_BUFFER_OVERFLOW;
+        }
+        data += n;
+        length -= (size_t)n;
+    }
+    exporter->flushed += exporter->length;
+    exporter->length = 0;
+    return AXDR_SUCCESS;
+}
+
+// 确保缓冲区还能写入 n 个字节，n 不超过缓冲区容量
+static inline int export_reserve(AXDR_EXPORTER* e, size_t n) {
+    if (e->length + n <= e->capacity) {
+        return AXDR_SUCCESS;
+    }
+    if (e->fd < 0) {
+        return AXDR_ERROR_BUFFER_OVERFLOW;
+    }
+    return axdr_exporter_flush(e);
+}
+
+static int export_put(AXDR_EXPORTER* e, const char* data, size_t length) {
+    while (length > 0) {
+        size_t chunk = length < e->capacity ? length : e->capacity;
+        int result = export_reserve(e, chunk);
+        if (result != AXDR_SUCCESS) {
+            return result;
+        }
+        memcpy(e->out + e->length, data, chunk);
+        e->length += chunk;
+        data += chunk;
+        length -= chunk;
+    }
+    return AXDR_SUCCESS;
+}
+
+static inline int export_char(AXDR_EXPORTER* e, char c) {
+    int result = export_reserve(e, 1);
+    if (result == AXDR_SUCCESS) {
+        e->out[e->length++] = c;
+    }
+    return result;
+}
+
+// 引号：在 CSV 引号单元格内需要写成两个
+static inline int export_quote(AXDR_EXPORTER* e) {
+    int result = export_reserve(e, 2);
+    if (result == AXDR_SUCCESS) {
+        e->out[e->length++] = '"';
+        if (e->quoted) {
+            e->out[e->length++] = '"';
+        }
+    }
+    return result;
+}
+
+int axdr_export_write(AXDR_EXPORTER* exporter, const char* text, size_t length) {
+    if (!exporter || (!text && length > 0)) {
+        return AXDR_ERROR_INVALID_VALUE;
+    }
+    return export_put(exporter, text, length);
+}
+
+int axdr_export_int64(AXDR_EXPORTER* exporter, int64_t value) {
+    if (!exporter) {
+        return AXDR_ERROR_INVALID_VALUE;
+    }
+    int result = export_reserve(exporter, 20);
+    if (result != AXDR_SUCCESS) {
+        return result;
+    }
+
+    uint64_t magnitude = value < 0 ? 0 - (uint64_t)value : (uint64_t)value;
+    char digits[20];
+    char* p = digits + sizeof(digits);
+    while (magnitude >= 100) {
+        unsigned pair = (unsigned)(magnitude % 100);
+        magnitude /= 100;
+        p -= 2;
+        memcpy(p, export_digits + pair * 2, 2);
+    }
+    if (magnitude >= 10) {
+        p -= 2;
+        memcpy(p, export_digits + magnitude * 2, 2);
+    } else {
+        *--p = (char)('0' + magnitude);
+    }
+
+    char* out = exporter->out + exporter->length;
+    if (value < 0) {
+        *out++ = '-';
+    }
+    size_t length = (size_t)(digits + sizeof(digits) - p);
+    memcpy(out, p, length);
+    exporter->length = (size_t)(out + length - exporter->out);
+    return AXDR_SUCCESS;
+}
+
+// 字节内容按十六进制输出
+static int export_hex(AXDR_EXPORTER* e, const uint8_t* data, size_t length) {
+    while (length > 0) {
+        size_t chunk = length < e->capacity / 2 ? length : e->capacity / 2;
+        int result = export_reserve(e, chunk * 2);
+        if (result != AXDR_SUCCESS) {
+            return result;
+        }
+        char* out = e->out + e->length;
+        for (size_t i = 0; i < chunk; i++) {
+            out[2 * i] = export_hex_digits[data[i] >> 4];
+            out[2 * i + 1] = export_hex_digits[data[i] & 0x0F];
+        }
+        e->length += chunk * 2;
+        data += chunk;
+        length -= chunk;
+    }
+    return AXDR_SUCCESS;
+}
+
+// 输出字符串内容（不含两侧引号）。json 为真时按 JSON 规则转义，0x20-0x7E 以外的字节
+// 一律写成 \u00XX，输出总是合法的 UTF-8；否则只处理 CSV 单元格中的引号。
+// 不需转义的连续字节整段拷贝。
+static int export_text(AXDR_EXPORTER* e, const uint8_t* data, size_t length, int json) {
+    size_t i = 0;
+    while (i < length) {
+        size_t run = i;
+        if (json) {
+            while (run < length && data[run] >= 0x20 && data[run] < 0x7F && data[run] != '"' &&
+                   data[run] != '\\') {
+                run++;
+            }
+        } else {
+            while (run < length && data[run] != '"') {
+                run++;
+            }
+        }
+        int result = export_put(e, (const char*)data + i, run - i);
+        if (result != AXDR_SUCCESS || run == length) {
+            return result;
+        }
+
+        uint8_t c = data[run];
+        if (c == '"') {
+            if (json) {
+                result = export_char(e, '\\');
+            }
+            if (result == AXDR_SUCCESS) {
+                result = export_quote(e);
+            }
+        } else if (c == '\\') {
+            result = export_put(e, "\\\\", 2);
+        } else {
+            char escape[6] = {'\\', 0, 0, 0, 0, 0};
+            size_t n = 2;
+            switch (c) {
+            case '\n': escape[1] = 'n'; break;
+            case '\r': escape[1] = 'r'; break;
+            case '\t': escape[1] = 't'; break;
+            case '\b': escape[1] = 'b'; break;
+            case '\f': escape[1] = 'f'; break;
+            default:
+                memcpy(escape + 1, "u00", 3);
+                escape[4] = export_hex_digits[c >> 4];
+                escape[5] = export_hex_digits[c & 0x0F];
+                n = 6;
+                break;
+            }
+            result = export_put(e, escape, n);
+        }
+        if (result != AXDR_SUCCESS) {
+            return result;
+        }
+        i = run + 1;
+    }
+    return AXDR_SUCCESS;
+}
+
+// 带引号的字符串值
+static int export_string(AXDR_EXPORTER* e, const uint8_t* data, size_t length) {
+    int json = e->format == AXDR_EXPORT_JSON;
+    int quoted = e->quoted;
+    int result = export_quote(e);
+    if (!json) {
+        e->quoted = 1;
+    }
+    if (result == AXDR_SUCCESS) {
+        result = export_text(e, data, length, json);
+    }
+    e->quoted = quoted;
+    if (result == AXDR_SUCCESS) {
+        result = export_quote(e);
+    }
+    return result;
+}
+
+// CSV 单元格之间的分隔符
+static inline int export_cell(AXDR_EXPORTER* e) {
+    if (e->format != AXDR_EXPORT_CSV) {
+        return AXDR_SUCCESS;
+    }
+    return e->column++ > 0 ? export_char(e, ',') : AXDR_SUCCESS;
+}
+
+// 读取长度前缀后的内容，返回指向编码缓冲区的指针
+static int export_take(AXDR_CODEC* codec, size_t length, const uint8_t** data) {
+    if (length > codec->size - codec->position) {
+        return AXDR_ERROR_BUFFER_OVERFLOW;
+    }
+    *data = codec->buffer + codec->position;
+    codec->position += length;
+    axdr_checksum_fold(codec);
+    return AXDR_SUCCESS;
+}
+
+static int export_length(AXDR_CODEC* codec, const AXDR_SCHEMA* schema, int variable, size_t* length) {
+    int result;
+    if (variable) {
+        int32_t value;
+        result = axdr_decode_varint(codec, &value);
+        if (result == AXDR_SUCCESS && value < 0) {
+            result = AXDR_ERROR_CONSTRAINT;
+        }
+        if (result == AXDR_SUCCESS) {
+            *length = (size_t)(uint32_t)value;
+        }
+    } else {
+        uint32_t value;
+        result = axdr_decode_unsigned(codec, &value, UINT32_MAX);
+        if (result == AXDR_SUCCESS) {
+            *length = value;
+        }
+    }
+    if (result == AXDR_SUCCESS && schema->maxLength > 0 && *length > schema->maxLength &&
+        schema->type != AXDR_TYPE_BIT_STRING && schema->type != AXDR_TYPE_VARBIT_STRING) {
+        result = AXDR_ERROR_CONSTRAINT;
+    }
+    return result;
+}
+
+// "YYYYMMDDhhmmss" -> "YYYY-MM-DDThh:mm:ssZ"
+static int export_time(AXDR_EXPORTER* e, const uint8_t* text, size_t length) {
+    if (length != 14) {
+        return length > 14 ? AXDR_ERROR_CONSTRAINT : AXDR_ERROR_INVALID_VALUE;
+    }
+    for (size_t i = 0; i < 14; i++) {
+        if (text[i] < '0' || text[i] > '9') {
+            return AXDR_ERROR_INVALID_VALUE;
+        }
+    }
+    char iso[20];
+    memcpy(iso, text, 4);
+    iso[4] = '-';
+    memcpy(iso + 5, text + 4, 2);
+    iso[7] = '-';
+    memcpy(iso + 8, text + 6, 2);
+    iso[10] = 'T';
+    memcpy(iso + 11, text + 8, 2);
+    iso[13] = ':';
+    memcpy(iso + 14, text + 10, 2);
+    iso[16] = ':';
+    memcpy(iso + 17, text + 12, 2);
+    iso[19] = 'Z';
+
+    int result = export_quote(e);
+    if (result == AXDR_SUCCESS) {
+        result = export_put(e, iso, sizeof(iso));
+    }
+    if (result == AXDR_SUCCESS) {
+        result = export_quote(e);
+    }
+    return result;
+}
+
+// 浮点数：最短可还原的有效位数（float32 9 位、float64 17 位）；
+// NaN 与无穷在 JSON 中写 null，在 CSV 中为空单元格
+static int export_double(AXDR_EXPORTER* e, double value, int digits) {
+    if (value != value || value - value != 0) {
+        return e->format == AXDR_EXPORT_JSON ? export_put(e, "null", 4) : AXDR_SUCCESS;
+    }
+    char text[32];
+    int length = snprintf(text, sizeof(text), "%.*g", digits, value);
+    return export_put(e, text, (size_t)length);
+}
+
+// 本地时间加偏移："YYYY-MM-DDThh:mm:ss+hh:mm"，偏移为 0 时写 'Z'，偏移未指定时省略；
+// 年月日时分秒有未指定的字段（或年份超过 4 位）时按 12 个原始字节输出十六进制
+static int export_date_time(AXDR_EXPORTER* e, AXDR_CODEC* codec) {
+    size_t start = codec->position;
+    AXDR_DATE_TIME value;
+    int result = axdr_decode_date_time(codec, &value);
+    if (result != AXDR_SUCCESS) {
+        return result;
+    }
+
+    time_t utc;
+    if (axdr_date_time_to_time(&value, &utc) != AXDR_SUCCESS || value.year > 9999) {
+        result = export_quote(e);
+        if (result == AXDR_SUCCESS) {
+            result = export_hex(e, codec->buffer + start, AXDR_DATE_TIME_SIZE);
+        }
+        return result == AXDR_SUCCESS ? export_quote(e) : result;
+    }
+
+    const unsigned fields[5] = {value.month, value.day, value.hour, value.minute, value.second};
+    static const char separators[5] = {'-', '-', 'T', ':', ':'};
+    char iso[25];
+    size_t length = 4;
+    iso[0] = (char)('0' + value.year / 1000 % 10);
+    iso[1] = (char)('0' + value.year / 100 % 10);
+    memcpy(iso + 2, export_digits + value.year % 100 * 2, 2);
+    for (size_t i = 0; i < 5; i++) {
+        iso[length++] = separators[i];
+        memcpy(iso + length, export_digits + fields[i] * 2, 2);
+        length += 2;
+    }
+    if (value.deviation == 0) {
+        iso[length++] = 'Z';
+    } else if (value.deviation != AXDR_DATE_TIME_DEVIATION_ANY) {
+        // deviation 为 UTC 减本地时间，ISO 偏移取其相反数
+        int offset = -value.deviation;
+        iso[length++] = offset < 0 ? '-' : '+';
+        offset = offset < 0 ? -offset : offset;
+        memcpy(iso + length, export_digits + offset / 60 * 2, 2);
+        iso[length + 2] = ':';
+        memcpy(iso + length + 3, export_digits + offset % 60 * 2, 2);
+        length += 5;
+    }
+
+    result = export_quote(e);
+    if (result == AXDR_SUCCESS) {
+        result = export_put(e, iso, length);
+    }
+    if (result == AXDR_SUCCESS) {
+        result = export_quote(e);
+    }
+    return result;
+}
+
+static int export_node(AXDR_EXPORTER* e, AXDR_CODEC* codec, const AXDR_SCHEMA* schema, int depth);
+
+static int export_sequence(AXDR_EXPORTER* e, AXDR_CODEC* codec, const AXDR_SCHEMA* schema, int depth) {
+    int json = e->format == AXDR_EXPORT_JSON;
+    int result = json ? export_char(e, '{') : AXDR_SUCCESS;
+
+    for (size_t i = 0; i < schema->childCount && result == AXDR_SUCCESS; i++) {
+        const AXDR_SCHEMA* child = &schema->children[i];
+        if (json) {
+            // 对象键：未命名的字段以序号作为键
+            if (i > 0) {
+                result = export_char(e, ',');
+            }
+            if (result == AXDR_SUCCESS) {
+                result = export_quote(e);
+            }
+            if (result == AXDR_SUCCESS) {
+                result = child->name ? export_put(e, child->name, strlen(child->name))
+                                     : axdr_export_int64(e, (int64_t)i);
+            }
+            if (result == AXDR_SUCCESS) {
+                result = export_quote(e);
+            }
+            if (result == AXDR_SUCCESS) {
+                result = export_char(e, ':');
+            }
+        }
+        if (result == AXDR_SUCCESS) {
+            result = export_node(e, codec, child, depth + 1);
+        }
+    }
+
+    if (result == AXDR_SUCCESS && json) {
+        result = export_char(e, '}');
+    }
+    return result;
+}
+
+// 定长编码的字节数，变长类型返回 0（NULL 也为 0，两者都不能据剩余字节限制元素个数）
+static size_t export_wire_size(const AXDR_SCHEMA* schema) {
+    switch (schema->type) {
+    case AXDR_TYPE_BOOLEAN:
+        return 1;
+    case AXDR_TYPE_INTEGER:
+    case AXDR_TYPE_UNSIGNED:
+    case AXDR_TYPE_ENUM:
+    case AXDR_TYPE_FLOAT32:
+        return 4;
+    case AXDR_TYPE_FLOAT64:
+        return 8;
+    case AXDR_TYPE_DATE_TIME:
+        return AXDR_DATE_TIME_SIZE;
+    case AXDR_TYPE_SEQUENCE: {
+        size_t size = 0;
+        for (size_t i = 0; i < schema->childCount; i++) {
+            if (schema->children[i].type == AXDR_TYPE_NULL) {
+                continue;
+            }
+            size_t child = export_wire_size(&schema->children[i]);
+            if (child == 0) {
+                return 0;
+            }
+            size += child;
+        }
+        return size;
+    }
+    default:
+        return 0;
+    }
+}
+
+static int export_sequence_of(AXDR_EXPORTER* e, AXDR_CODEC* codec, const AXDR_SCHEMA* schema, int depth) {
+    if (schema->childCount != 1 || !schema->children) {
+        return AXDR_ERROR_INVALID_TYPE;
+    }
+
+    uint32_t count;
+    uint32_t maxCount = schema->maxLength > 0 ? schema->maxLength : UINT32_MAX;
+    int result = axdr_decode_unsigned(codec, &count, maxCount);
+    if (result != AXDR_SUCCESS) {
+        return result;
+    }
+    // 定长元素的个数不能超过剩余字节，不必逐个输出到数据末尾才发现截断
+    size_t wireSize = export_wire_size(schema->children);
+    if (wireSize > 0 && count > (codec->size - codec->position) / wireSize) {
+        return AXDR_ERROR_BUFFER_OVERFLOW;
+    }
+    // 预算：与 axdr_decode_sequence_of 相同，元素个数一次性计入，零宽元素也受限
+    result = axdr_budget_elements(codec, count);
+    if (result == AXDR_SUCCESS) {
+        result = axdr_budget_enter(codec);
+    }
+    if (result != AXDR_SUCCESS) {
+        return result;
+    }
+
+    // CSV 中整个数组占一个单元格，内容按 JSON 输出
+    int format = e->format;
+    int quoted = e->quoted;
+    if (format == AXDR_EXPORT_CSV) {
+        result = export_char(e, '"');
+        e->format = AXDR_EXPORT_JSON;
+        e->quoted = 1;
+    }
+
+    if (result == AXDR_SUCCESS) {
+        result = export_char(e, '[');
+    }
+    for (uint32_t i = 0; i < count && result == AXDR_SUCCESS; i++) {
+        if (i > 0) {
+            result = export_char(e, ',');
+        }
+        if (result == AXDR_SUCCESS) {
+            result = export_node(e, codec, schema->children, depth + 1);
+        }
+    }
+    if (result == AXDR_SUCCESS) {
+        result = export_char(e, ']');
+    }
+
+    axdr_budget_leave(codec);
+    e->format = format;
+    e->quoted = quoted;
+    if (result == AXDR_SUCCESS && format == AXDR_EXPORT_CSV) {
+        result = export_char(e, '"');
+    }
+    return result;
+}
+
+static int export_node(AXDR_EXPORTER* e, AXDR_CODEC* codec, const AXDR_SCHEMA* schema, int depth) {
+    if (depth > AXDR_EXPORT_MAX_DEPTH) {
+        return AXDR_ERROR_CONSTRAINT;
+    }
+
+    if (schema->type == AXDR_TYPE_SEQUENCE) {
+        return export_sequence(e, codec, schema, depth);
+    }
+
+    int result = export_cell(e);
+    if (result != AXDR_SUCCESS) {
+        return result;
+    }
+
+    const uint8_t* data;
+    size_t length;
+    switch (schema->type) {
+    case AXDR_TYPE_NULL:
+        result = axdr_decode_null(codec);
+        if (result == AXDR_SUCCESS && e->format == AXDR_EXPORT_JSON) {
+            result = export_put(e, "null", 4);
+        }
+        return result;
+
+    case AXDR_TYPE_INTEGER: {
+        int32_t value;
+        int32_t min = schema->min < INT32_MIN ? INT32_MIN : (int32_t)schema->min;
+        int32_t max = schema->max > INT32_MAX ? INT32_MAX : (int32_t)schema->max;
+        result = axdr_decode_integer(codec, &value, min, max);
+        return result == AXDR_SUCCESS ? axdr_export_int64(e, value) : result;
+    }
+
+    case AXDR_TYPE_UNSIGNED: {
+        uint32_t value;
+        uint32_t max = schema->max > UINT32_MAX || schema->max < 0 ? UINT32_MAX : (uint32_t)schema->max;
+        result = axdr_decode_unsigned(codec, &value, max);
+        return result == AXDR_SUCCESS ? axdr_export_int64(e, value) : result;
+    }
+
+    case AXDR_TYPE_BOOLEAN: {
+        bool value;
+        result = axdr_decode_boolean(codec, &value);
+        if (result != AXDR_SUCCESS) {
+            return result;
+        }
+        return value ? export_put(e, "true", 4) : export_put(e, "false", 5);
+    }
+
+    case AXDR_TYPE_ENUM: {
+        int value;
+        result = axdr_decode_enum(codec, &value, (int)schema->max);
+        return result == AXDR_SUCCESS ? axdr_export_int64(e, value) : result;
+    }
+
+    case AXDR_TYPE_VARINT: {
+        int32_t value;
+        result = axdr_decode_varint(codec, &value);
+        return result == AXDR_SUCCESS ? axdr_export_int64(e, value) : result;
+    }
+
+    case AXDR_TYPE_BIT_STRING:
+    case AXDR_TYPE_VARBIT_STRING:
+        result = export_length(codec, schema, schema->type == AXDR_TYPE_VARBIT_STRING, &length);
+        if (result == AXDR_SUCCESS) {
+            length = (length + 7) / 8;
+        }
+        break;
+
+    case AXDR_TYPE_OCTET_STRING:
+    case AXDR_TYPE_VISIBLE_STRING:
+    case AXDR_TYPE_GENERALIZED_TIME:
+        result = export_length(codec, schema, 0, &length);
+        break;
+
+    case AXDR_TYPE_VAROCTET_STRING:
+    case AXDR_TYPE_VARVISIBLE_STRING:
+        result = export_length(codec, schema, 1, &length);
+        break;
+
+    case AXDR_TYPE_FLOAT32: {
+        float value;
+        result = axdr_decode_float32(codec, &value);
+        return result == AXDR_SUCCESS ? export_double(e, value, 9) : result;
+    }
+
+    case AXDR_TYPE_FLOAT64: {
+        double value;
+        result = axdr_decode_float64(codec, &value);
+        return result == AXDR_SUCCESS ? export_double(e, value, 17) : result;
+    }
+
+    case AXDR_TYPE_DATE_TIME:
+        return export_date_time(e, codec);
+
+    case AXDR_TYPE_SEQUENCE_OF:
+        return export_sequence_of(e, codec, schema, depth);
+
+    default:
+        return AXDR_ERROR_INVALID_TYPE;
+    }
+
+    if (result == AXDR_SUCCESS) {
+        result = export_take(codec, length, &data);
+    }
+    if (result != AXDR_SUCCESS) {
+        return result;
+    }
+
+    switch (schema->type) {
+    case AXDR_TYPE_VISIBLE_STRING: {
+        // 与 axdr_decode_visible_string 相同的字符范围校验
+        size_t valid = axdr_visible_copy(data, length, NULL);
+        if (valid != length) {
+            codec->error = AXDR_ERROR_INVALID_VALUE;
+            codec->errorOffset = (size_t)(data - codec->buffer) + valid;
+            return AXDR_ERROR_INVALID_VALUE;
+        }
+        return export_string(e, data, length);
+    }
+    case AXDR_TYPE_VARVISIBLE_STRING:
+        return export_string(e, data, length);
+    case AXDR_TYPE_GENERALIZED_TIME:
+        return export_time(e, data, length);
+    default:
+        result = export_quote(e);
+        if (result == AXDR_SUCCESS) {
+            result = export_hex(e, data, length);
+        }
+        if (result == AXDR_SUCCESS) {
+            result = export_quote(e);
+        }
+        return result;
+    }
+}
+
+int axdr_export_value(AXDR_EXPORTER* exporter, AXDR_CODEC* codec, const AXDR_SCHEMA* schema) {
+    if (!exporter || !codec || !schema) {
+        return AXDR_ERROR_INVALID_VALUE;
+    }
+    return export_node(exporter, codec, schema, 0);
+}
+
+int axdr_export_record(AXDR_EXPORTER* exporter, AXDR_CODEC* codec, const AXDR_SCHEMA* schema) {
+    if (!exporter || !codec || !schema) {
+        return AXDR_ERROR_INVALID_VALUE;
+    }
+
+    size_t mark = exporter->length;
+    size_t position = codec->position;
+    exporter->column = 0;
+    int result = export_node(exporter, codec, schema, 0);
+    if (result == AXDR_SUCCESS) {
+        result = export_char(exporter, '\n');
+    }
+    if (result != AXDR_SUCCESS && exporter->fd < 0) {
+        exporter->length = mark;
+        codec->position = position;
+    }
+    return result;
+}
+
+// 按字段路径输出列名
+static int export_header_node(AXDR_EXPORTER* e, const AXDR_SCHEMA* schema,
+                              char* path, size_t pathLength, size_t pathCapacity, int depth) {
+    if (depth > AXDR_EXPORT_MAX_DEPTH) {
+        return AXDR_ERROR_CONSTRAINT;
+    }
+
+    if (schema->type != AXDR_TYPE_SEQUENCE) {
+        int result = export_cell(e);
+        if (result != AXDR_SUCCESS) {
+            return result;
+        }
+        if (pathLength == 0) {
+            return export_put(e, "value", 5);
+        }
+        // 列名中可能含有分隔符时加引号
+        if (memchr(path, ',', pathLength) || memchr(path, '"', pathLength)) {
+            return export_string(e, (const uint8_t*)path, pathLength);
+        }
+        return export_put(e, path, pathLength);
+    }
+
+    for (size_t i = 0; i < schema->childCount; i++) {
+        const AXDR_SCHEMA* child = &schema->children[i];
+        char index[24];
+        const char* name = child->name;
+        size_t nameLength;
+        if (name) {
+            nameLength = strlen(name);
+        } else {
+            // 未命名字段以序号作为列名
+            size_t n = 0;
+            size_t value = i;
+            do {
+                index[sizeof(index) - 1 - n++] = (char)('0' + value % 10);
+                value /= 10;
+            } while (value > 0);
+            name = index + sizeof(index) - n;
+            nameLength = n;
+        }
+
+        size_t length = pathLength;
+        size_t needed = length + (length > 0 ? 1 : 0) + nameLength;
+        if (needed >= pathCapacity) {
+            return AXDR_ERROR_INVALID_LENGTH;
+        }
+        if (length > 0) {
+            path[length++] = '.';
+        }
+        memcpy(path + length, name, nameLength);
+        length += nameLength;
+
+        int result = export_header_node(e, child, path, length, pathCapacity, depth + 1);
+        if (result != AXDR_SUCCESS) {
+            return result;
+        }
+    }
+    return AXDR_SUCCESS;
+}
+
+int axdr_export_csv_header(AXDR_EXPORTER* exporter, const AXDR_SCHEMA* schema) {
+    if (!exporter || !schema) {
+        return AXDR_ERROR_INVALID_VALUE;
+    }
+
+    char path[256];
+    size_t length = 0;
+    // 根节点本身的名字不作为前缀，除非它是单个值
+    if (schema->type != AXDR_TYPE_SEQUENCE && schema->name) {
+        length = strlen(schema->name);
+        if (length >= sizeof(path)) {
+            return AXDR_ERROR_INVALID_LENGTH;
+        }
+        memcpy(path, schema->name, length);
+    }
+
+    int format = exporter->format;
+    exporter->format = AXDR_EXPORT_CSV;
+    exporter->column = 0;
+    int result = export_header_node(exporter, schema, path, length, sizeof(path), 0);
+    exporter->format = format;
+    if (result == AXDR_SUCCESS) {
+        result = export_char(exporter, '\n');
+    }
+    return result;
+}
@@ -0,0 +1,55 @@
+#ifndef AXDR_EXPORT_H
+#define AXDR_EXPORT_H
+
+#include "axdr_schema.h"
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// 流式导出：按模式直接遍历编码数据，输出 JSON 或 CSV 文本，不经过中间结构体
+//
+// JSON：SEQUENCE 输出为对象，SEQUENCE OF 输出为数组，字节串/位串输出为十六进制字符串，
+// GENERALIZED TIME 输出为 "YYYY-MM-DDThh:mm:ssZ"。每条记录一行（JSON Lines）。
+// CSV：SEQUENCE 逐层展开为列，列名为以 '.' 连接的字段路径；SEQUENCE OF 整体作为
+// 一个单元格，内容为 JSON 数组。
+
+#define AXDR_EXPORT_JSON       0
+#define AXDR_EXPORT_CSV        1
+
+#define AXDR_EXPORT_MAX_DEPTH  32      // 模式最大嵌套深度
+#define AXDR_EXPORT_MIN_BUFFER 64      // 输出缓冲区最小容量
+
+typedef struct {
+    int      format;        // AXDR_EXPORT_JSON / AXDR_EXPORT_CSV
+    char*    out;           // 输出缓冲区
+    size_t   capacity;      // 输出缓冲区容量
+    size_t   length;        // 缓冲区中已写入的字节数
+    int      fd;            // >= 0 时缓冲区写满后写入 fd；< 0 时写满返回 AXDR_ERROR_BUFFER_OVERFLOW
+    int      quoted;        // 正在输出 CSV 引号单元格，'"' 需写成 '""'
+    size_t   column;        // CSV 当前行已输出的列数
+    uint64_t flushed;       // 已写入 fd 的总字节数
+} AXDR_EXPORTER;
+
+// 初始化导出器：fd < 0 时只写入 out，调用者从 out[0..length) 取结果
+int axdr_exporter_init(AXDR_EXPORTER* exporter, int format, char* out, size_t capacity, int fd);
+// 把缓冲区内容写入 fd（未设置 fd 时什么也不做）
+int axdr_exporter_flush(AXDR_EXPORTER* exporter);
+
+// 导出 codec 当前位置的一个值，codec->position 前进到值之后，不输出换行
+int axdr_export_value(AXDR_EXPORTER* exporter, AXDR_CODEC* codec, const AXDR_SCHEMA* schema);
+// 导出一条记录并换行；只写缓冲区时失败不留下半条记录
+int axdr_export_record(AXDR_EXPORTER* exporter, AXDR_CODEC* codec, const AXDR_SCHEMA* schema);
+// 输出 CSV 表头（列名）并换行
+int axdr_export_csv_header(AXDR_EXPORTER* exporter, const AXDR_SCHEMA* schema);
+
+// 辅助输出：原样文本、十进制整数，用于在记录前后附加自定义列
+int axdr_export_write(AXDR_EXPORTER* exporter, const char* text, size_t length);
+int axdr_export_int64(AXDR_EXPORTER* exporter, int64_t value);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // AXDR_EXPORT_H
@@ -0,0 +1,169 @@
+#include "axdr_export.h"
+#include "axdr_framelog.h"
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+// 帧日志导出工具：按模式把帧日志中的记录转换为 JSON Lines 或 CSV
+// 用法: axdr_export [-f json|csv] [-m 表号] [-b 起始时间] [-e 结束时间] [-o 输出文件] 模式 帧日志
+
+#define EXPORT_TOOL_BUFFER  (1024 * 1024)
+
+typedef struct {
+    AXDR_EXPORTER*     exporter;
+    const AXDR_SCHEMA* schema;
+    uint64_t           records;
+    uint64_t           skipped;
+} EXPORT_TOOL;
+
+static int export_tool_visit(void* ctx, uint32_t meterId, int64_t timestamp, AXDR_CODEC* frame) {
+    EXPORT_TOOL* tool = (EXPORT_TOOL*)ctx;
+    AXDR_EXPORTER* e = tool->exporter;
+    size_t mark = e->length;
+    uint64_t flushed = e->flushed;
+
+    int result;
+    if (e->format == AXDR_EXPORT_JSON) {
+        result = axdr_export_write(e, "{\"meter\":", 9);
+        if (result == AXDR_SUCCESS) result = axdr_export_int64(e, meterId);
+        if (result == AXDR_SUCCESS) result = axdr_export_write(e, ",\"timestamp\":", 13);
+        if (result == AXDR_SUCCESS) result = axdr_export_int64(e, timestamp);
+        if (result == AXDR_SUCCESS) result = axdr_export_write(e, ",\"data\":", 8);
+        if (result == AXDR_SUCCESS) result = axdr_export_value(e, frame, tool->schema);
+        if (result == AXDR_SUCCESS) result = axdr_export_write(e, "}\n", 2);
+    } else {
+        result = axdr_export_int64(e, meterId);
+        if (result == AXDR_SUCCESS) result = axdr_export_write(e, ",", 1);
+        if (result == AXDR_SUCCESS) result = axdr_export_int64(e, timestamp);
+        if (result == AXDR_SUCCESS) result = axdr_export_write(e, ",", 1);
+        if (result == AXDR_SUCCESS) result = axdr_export_record(e, frame, tool->schema);
+    }
+
+    if (result == AXDR_SUCCESS) {
+        tool->records++;
+        return AXDR_SUCCESS;
+    }
+
+    // 帧与模式不符：本条记录尚未写出时丢弃并继续
+    if (e->flushed == flushed) {
+        fprintf(stderr, "skip record meter=%u timestamp=%lld: error %d\n",
+                meterId, (long long)timestamp, result);
+        e->length = mark;
+        tool->skipped++;
+        return AXDR_SUCCESS;
+    }
+    return result;
+}
+
+static void usage(const char* program) {
+    fprintf(stderr,
+            "usage: %s [-f json|csv] [-m meter] [-b from] [-e to] [-o output] SCHEMA FRAMELOG\n"
+            "  SCHEMA e.g. \"{id:int, active:bool, name:string(32), readings:[int](96)}\"\n",
+            program);
+}
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int main(int argc, char** argv) {
+    int format = AXDR_EXPORT_JSON;
+    uint32_t meterId = AXDR_FRAMELOG_ANY_METER;
+    int64_t from = INT64_MIN;
+    int64_t to = INT64_MAX;
+    const char* output = NULL;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "f:m:b:e:o:h")) != -1) {
+        switch (opt) {
+        case 'f':
+            if (strcmp(optarg, "json") == 0) {
+                format = AXDR_EXPORT_JSON;
+            } else if (strcmp(optarg, "csv") == 0) {
+                format = AXDR_EXPORT_CSV;
+            } else {
+                usage(argv[0]);
+                return 2;
+            }
+            break;
+        case 'm': meterId = (uint32_t)strtoul(optarg, NULL, 10); break;
+        case 'b': from = strtoll(optarg, NULL, 10); break;
+        case 'e': to = strtoll(optarg, NULL, 10); break;
+        case 'o': output = optarg; break;
+        default:
+            usage(argv[0]);
+            return 2;
+        }
+    }
+    if (argc - optind != 2) {
+        usage(argv[0]);
+        return 2;
+    }
+
+    AXDR_SCHEMA* schema = axdr_schema_parse(argv[optind]);
+    if (!schema) {
+        fprintf(stderr, "invalid schema: %s\n", argv[optind]);
+        return 2;
+    }
+
+    AXDR_FRAMELOG_READER* reader = axdr_framelog_reader_open(argv[optind + 1]);
+    if (!reader) {
+        fprintf(stderr, "cannot open frame log: %s\n", argv[optind + 1]);
+        axdr_schema_free(schema);
+        return 1;
+    }
+
+    int fd = 1;
+    if (output) {
+        fd = open(output, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if (fd < 0) {
+            fprintf(stderr, "cannot open output: %s\n", output);
+            axdr_framelog_reader_close(reader);
+            axdr_schema_free(schema);
+            return 1;
+        }
+    }
+
+    char* buffer = (char*)malloc(EXPORT_TOOL_BUFFER);
+    AXDR_EXPORTER exporter;
+    int result = buffer ? axdr_exporter_init(&exporter, format, buffer, EXPORT_TOOL_BUFFER, fd)
+                        : AXDR_ERROR_BUFFER_OVERFLOW;
+
+    if (result == AXDR_SUCCESS && format == AXDR_EXPORT_CSV) {
+        result = axdr_export_write(&exporter, "meter,timestamp,", 16);
+        if (result == AXDR_SUCCESS) {
+            result = axdr_export_csv_header(&exporter, schema);
+        }
+    }
+
+    EXPORT_TOOL tool = {&exporter, schema, 0, 0};
+    double start = now_seconds();
+    if (result == AXDR_SUCCESS) {
+        result = axdr_framelog_query(reader, meterId, from, to, export_tool_visit, &tool);
+    }
+    if (result == AXDR_SUCCESS) {
+        result = axdr_exporter_flush(&exporter);
+    }
+    double elapsed = now_seconds() - start;
+
+    uint64_t bytes = result == AXDR_SUCCESS ? exporter.flushed : 0;
+    fprintf(stderr, "%llu records (%llu skipped), %llu bytes in %.3f s (%.1f MB/s)\n",
+            (unsigned long long)tool.records, (unsigned long long)tool.skipped,
+            (unsigned long long)bytes, elapsed, elapsed > 0 ? bytes / elapsed / 1e6 : 0.0);
+    if (result != AXDR_SUCCESS) {
+        fprintf(stderr, "export failed: error %d\n", result);
+    }
+
+    free(buffer);
+    if (output) {
+        close(fd);
+    }
+    axdr_framelog_reader_close(reader);
+    axdr_schema_free(schema);
+    return result == AXDR_SUCCESS ? 0 : 1;
+}
@@ -0,0 +1,209 @@
+#include "axdr_fingerprint.h"
+#include "axdr_datetime.h"
+#include "axdr_hash.h"
+#include "axdr_walk.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define FINGERPRINT_VARIABLE  SIZE_MAX
+
+// 字段的编码长度，变长类型返回 FINGERPRINT_VARIABLE
+static size_t fingerprint_fixed_size(const AXDR_SCHEMA* node) {
+    switch (node->type) {
+    case AXDR_TYPE_NULL:
+        return 0;
+    case AXDR_TYPE_BOOLEAN:
+        return 1;
+    case AXDR_TYPE_INTEGER:
+    case AXDR_TYPE_UNSIGNED:
+    case AXDR_TYPE_ENUM:
+    case AXDR_TYPE_FLOAT32:
+        return 4;
+    case AXDR_TYPE_FLOAT64:
+        return 8;
+    case AXDR_TYPE_GENERALIZED_TIME:
+        return 4 + 14;      // 长度前缀 + YYYYMMDDhhmmss
+    case AXDR_TYPE_DATE_TIME:
+        return AXDR_DATE_TIME_SIZE;
+    case AXDR_TYPE_SEQUENCE: {
+        size_t total = 0;
+        for (size_t i = 0; i < node->childCount; i++) {
+            size_t size = fingerprint_fixed_size(&node->children[i]);
+            if (size == FINGERPRINT_VARIABLE) {
+                return FINGERPRINT_VARIABLE;
+            }
+            total += size;
+        }
+        return total;
+    }
+    default:
+        return FINGERPRINT_VARIABLE;
+    }
+}
+
+// 第 i 个及之后的顶层字段中还有要排除的
+static inline int fingerprint_more_excluded(const AXDR_FINGERPRINT_PLAN* plan, size_t i) {
+    return i < AXDR_FINGERPRINT_MAX_FIELDS && (plan->excludeMask >> i) != 0;
+}
+
+int axdr_fingerprint_plan_init(AXDR_FINGERPRINT_PLAN* plan, const AXDR_SCHEMA* schema,
+                               const char* const* excludeNames, size_t excludeCount,
+                               size_t payloadOffset) {
+    if (!plan || (!excludeNames && excludeCount > 0) || (!schema && excludeCount > 0)) {
+        return AXDR_ERROR_INVALID_VALUE;
+    }
+    if (schema && schema->type != AXDR_TYPE_SEQUENCE) {
+        return AXDR_ERROR_INVALID_TYPE;
+    }
+
+    memset(plan, 0, sizeof(AXDR_FINGERPRINT_PLAN));
+    plan->schema = schema;
+    plan->payloadOffset = payloadOffset;
+    plan->fixed = 1;
+    if (!schema) {
+        return AXDR_SUCCESS;
+    }
+
+    // 按名称查找排除的字段
+    for (size_t n = 0; n < excludeCount; n++) {
+        size_t i = 0;
+        while (i < schema->childCount &&
+               !(schema->children[i].name && strcmp(schema->children[i].name, excludeNames[n]) == 0)) {
+            i++;
+        }
+        if (i == schema->childCount) {
+            return AXDR_ERROR_INVALID_VALUE;
+        }
+        if (i >= AXDR_FINGERPRINT_MAX_FIELDS) {
+            return AXDR_ERROR_CONSTRAINT;
+        }
+        plan->excludeMask |= 1ull << i;
+    }
+
+    // 排除的字段之前全是定长字段时预先算出偏移，相邻的范围合并
+    size_t offset = payloadOffset;
+    for (size_t i = 0; plan->fixed && fingerprint_more_excluded(plan, i); i++) {
+        size_t size = fingerprint_fixed_size(&schema->children[i]);
+        if (size == FINGERPRINT_VARIABLE) {
+            plan->fixed = 0;
+            break;
+        }
+        if (plan->excludeMask & (1ull << i)) {
+            AXDR_BYTE_RANGE* last = plan->excludedCount > 0 ? &plan->excluded[plan->excludedCount - 1] : NULL;
+            if (last && last->offset + last->length == offset) {
+                last->length += size;
+            } else if (plan->excludedCount < AXDR_FINGERPRINT_MAX_RANGES) {
+                plan->excluded[plan->excludedCount].offset = offset;
+                plan->excluded[plan->excludedCount].length = size;
+                plan->excludedCount++;
+            } else {
+                plan->fixed = 0;
+            }
+        }
+        offset += size;
+    }
+    if (!plan->fixed) {
+        plan->excludedCount = 0;
+    }
+    return AXDR_SUCCESS;
+}
+
+// 把 [start, end) 计入指纹
+static inline uint64_t fingerprint_add(uint64_t hash, const uint8_t* frame, size_t start, size_t end) {
+    return end > start ? axdr_hash64(frame + start, end - start, hash) : hash;
+}
+
+int axdr_fingerprint(const AXDR_FINGERPRINT_PLAN* plan, const uint8_t* frame, size_t length,
+                     uint64_t* fingerprint) {
+    if (!plan || (!frame && length > 0) || !fingerprint) {
+        return AXDR_ERROR_INVALID_VALUE;
+    }
+
+    uint64_t hash = 0;
+    if (plan->fixed) {
+        size_t start = 0;
+        for (size_t i = 0; i < plan->excludedCount; i++) {
+            const AXDR_BYTE_RANGE* range = &plan->excluded[i];
+            if (range->offset + range->length > length) {
+                return AXDR_ERROR_BUFFER_OVERFLOW;
+            }
+            hash = fingerprint_add(hash, frame, start, range->offset);
+            start = range->offset + range->length;
+        }
+        hash = fingerprint_add(hash, frame, start, length);
+        *fingerprint = hash | 1;
+        return AXDR_SUCCESS;
+    }
+
+    // 逐个跳过顶层字段，定位排除字段的字节范围
+    if (plan->payloadOffset > length) {
+        return AXDR_ERROR_BUFFER_OVERFLOW;
+    }
+    AXDR_WALK_FRAME frames[AXDR_WALK_DEFAULT_DEPTH];
+    AXDR_WALKER walker;
+    axdr_walker_init(&walker, frames, AXDR_WALK_DEFAULT_DEPTH);
+    AXDR_CODEC codec;
+    axdr_codec_attach(&codec, (uint8_t*)frame, length);
+    codec.position = plan->payloadOffset;
+
+    const AXDR_SCHEMA* schema = plan->schema;
+    size_t start = 0;
+    for (size_t i = 0; fingerprint_more_excluded(plan, i); i++) {
+        size_t fieldStart = codec.position;
+        int result = axdr_walk_decode(&walker, &codec, &schema->children[i], NULL);
+        if (result != AXDR_SUCCESS) {
+            return result;
+        }
+        if (plan->excludeMask & (1ull << i)) {
+            hash = fingerprint_add(hash, frame, start, fieldStart);
+            start = codec.position;
+        }
+    }
+    hash = fingerprint_add(hash, frame, start, length);
+    *fingerprint = hash | 1;
+    return AXDR_SUCCESS;
+}
+
+// 数据源指纹表
+AXDR_FINGERPRINT_TABLE* axdr_fingerprint_table_create(size_t sources) {
+    if (sources == 0) {
+        return NULL;
+    }
+    AXDR_FINGERPRINT_TABLE* table = (AXDR_FINGERPRINT_TABLE*)calloc(1, sizeof(AXDR_FINGERPRINT_TABLE));
+    if (!table) {
+        return NULL;
+    }
+    table->last = (uint64_t*)calloc(sources, sizeof(uint64_t));
+    if (!table->last) {
+        free(table);
+        return NULL;
+    }
+    table->capacity = sources;
+    return table;
+}
+
+void axdr_fingerprint_table_destroy(AXDR_FINGERPRINT_TABLE* table) {
+    if (table) {
+        free(table->last);
+        free(table);
+    }
+}
+
+int axdr_fingerprint_table_check(AXDR_FINGERPRINT_TABLE* table, size_t source, uint64_t fingerprint) {
+    if (!table || source >= table->capacity || fingerprint == 0) {
+        return AXDR_ERROR_INVALID_VALUE;
+    }
+    if (table->last[source] == fingerprint) {
+        table->unchanged++;
+        return 1;
+    }
+    table->last[source] = fingerprint;
+    table->changed++;
+    return 0;
+}
+
+void axdr_fingerprint_table_forget(AXDR_FINGERPRINT_TABLE* table, size_t source) {
+    if (table && source < table->capacity) {
+        table->last[source] = 0;
+    }
+}
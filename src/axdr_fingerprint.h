@@ -0,0 +1,66 @@
+#ifndef AXDR_FINGERPRINT_H
+#define AXDR_FINGERPRINT_H
+
+#include "axdr_schema.h"
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// 原始帧指纹
+//
+// 在不解码的情况下对编码字节计算 64 位指纹（axdr_hash64），与同一数据源上一帧的指纹
+// 相同即可跳过解码。时间戳等易变字段按名称从指纹中排除：
+//   - 排除的字段及其之前的字段都是定长类型时，排除范围在创建时算好，按固定偏移直接分段哈希；
+//   - 否则按模式跳过（不写入）顶层字段以定位各字段的字节范围，再对保留的部分分段哈希。
+// 只能排除顶层 SEQUENCE 的直接子字段，最多 64 个。
+// 指纹只在进程内比较（见 axdr_hash.h），不为 0。
+
+#define AXDR_FINGERPRINT_MAX_FIELDS  64
+#define AXDR_FINGERPRINT_MAX_RANGES  8
+
+typedef struct {
+    size_t offset;
+    size_t length;
+} AXDR_BYTE_RANGE;
+
+typedef struct {
+    const AXDR_SCHEMA* schema;          // 顶层 SEQUENCE；NULL 时对整帧哈希
+    size_t          payloadOffset;      // 编码数据在帧中的起点（如 4 字节长度前缀之后）
+    uint64_t        excludeMask;        // 第 i 位对应排除第 i 个顶层字段
+    int             fixed;              // 排除范围为固定偏移
+    AXDR_BYTE_RANGE excluded[AXDR_FINGERPRINT_MAX_RANGES];  // 相对帧起点，按偏移升序
+    size_t          excludedCount;
+} AXDR_FINGERPRINT_PLAN;
+
+// excludeNames 为要排除的顶层字段名；名称不存在时返回 AXDR_ERROR_INVALID_VALUE
+int axdr_fingerprint_plan_init(AXDR_FINGERPRINT_PLAN* plan, const AXDR_SCHEMA* schema,
+                               const char* const* excludeNames, size_t excludeCount,
+                               size_t payloadOffset);
+
+// 计算一帧的指纹；需要遍历时数据不完整或不符合模式返回相应错误码
+int axdr_fingerprint(const AXDR_FINGERPRINT_PLAN* plan, const uint8_t* frame, size_t length,
+                     uint64_t* fingerprint);
+
+// 按数据源编号记录上一帧指纹
+typedef struct {
+    uint64_t* last;         // 0 表示尚未收到
+    size_t    capacity;
+    uint64_t  unchanged;    // 统计：与上一帧相同的次数
+    uint64_t  changed;      // 统计：新数据源或内容变化的次数
+} AXDR_FINGERPRINT_TABLE;
+
+AXDR_FINGERPRINT_TABLE* axdr_fingerprint_table_create(size_t sources);
+void axdr_fingerprint_table_destroy(AXDR_FINGERPRINT_TABLE* table);
+
+// 与上一帧相同返回 1；不同或首次出现时记录新指纹并返回 0；参数无效返回错误码
+int axdr_fingerprint_table_check(AXDR_FINGERPRINT_TABLE* table, size_t source, uint64_t fingerprint);
+// 清除某个数据源的记录（源重连、解码失败后）
+void axdr_fingerprint_table_forget(AXDR_FINGERPRINT_TABLE* table, size_t source);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // AXDR_FINGERPRINT_H
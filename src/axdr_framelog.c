@@ -0,0 +1,619 @@
+#include "axdr_framelog.h"
+#include "axdr_crc.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#define FRAMELOG_FILE_MAGIC     0x4158464Cu   // "AXFL"
+#define FRAMELOG_INDEX_MAGIC    0x41584649u   // "AXFI"
+#define FRAMELOG_BLOCK_MAGIC    0x424C4B31u   // "BLK1"
+#define FRAMELOG_VERSION        1u
+
+#define FRAMELOG_FILE_HEADER    16   // magic, version, blockSize, reserved
+#define FRAMELOG_INDEX_HEADER   8    // magic, version
+#define FRAMELOG_BLOCK_HEADER   40   // magic, count, payloadLength, crc, minTime, maxTime, meterMask
+#define FRAMELOG_INDEX_ENTRY    40   // offset, length, count, minTime, maxTime, meterMask
+#define FRAMELOG_RECORD_HEADER  16   // meterId, timestamp, frame length
+
+static uint64_t framelog_meter_bit(uint32_t meterId) {
+    return 1ull << ((meterId * 0x9E3779B1u) >> 26);
+}
+
+static int framelog_encode_u64(AXDR_CODEC* codec, uint64_t value) {
+    int result = axdr_encode_unsigned(codec, (uint32_t)(value >> 32), UINT32_MAX);
+    if (result != AXDR_SUCCESS) {
+        return result;
+    }
+    return axdr_encode_unsigned(codec, (uint32_t)value, UINT32_MAX);
+}
+
+static int framelog_decode_u64(AXDR_CODEC* codec, uint64_t* value) {
+    uint32_t high, low;
+    int result = axdr_decode_unsigned(codec, &high, UINT32_MAX);
+    if (result == AXDR_SUCCESS) {
+        result = axdr_decode_unsigned(codec, &low, UINT32_MAX);
+    }
+    if (result == AXDR_SUCCESS) {
+        *value = ((uint64_t)high << 32) | low;
+    }
+    return result;
+}
+
+static int framelog_pwrite(int fd, const uint8_t* data, size_t length, uint64_t offset) {
+    while (length > 0) {
+        ssize_t n = pwrite(fd, data, length, (off_t)offset);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            return AXDR_ERROR_BUFFER_OVERFLOW;
+        }
+        data += n;
+        length -= (size_t)n;
+        offset += (uint64_t)n;
+    }
+    return AXDR_SUCCESS;
+}
+
+static int framelog_pread(int fd, uint8_t* data, size_t length, uint64_t offset) {
+    while (length > 0) {
+        ssize_t n = pread(fd, data, length, (off_t)offset);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            return AXDR_ERROR_BUFFER_OVERFLOW;
+        }
+        data += n;
+        length -= (size_t)n;
+        offset += (uint64_t)n;
+    }
+    return AXDR_SUCCESS;
+}
+
+static void framelog_index_path(char* out, size_t size, const char* path) {
+    snprintf(out, size, "%s.idx", path);
+}
+
+static int framelog_encode_entry(AXDR_CODEC* codec, const AXDR_FRAMELOG_INDEX_ENTRY* entry) {
+    int result = framelog_encode_u64(codec, entry->offset);
+    if (result == AXDR_SUCCESS) result = axdr_encode_unsigned(codec, entry->length, UINT32_MAX);
+    if (result == AXDR_SUCCESS) result = axdr_encode_unsigned(codec, entry->count, UINT32_MAX);
+    if (result == AXDR_SUCCESS) result = framelog_encode_u64(codec, (uint64_t)entry->minTime);
+    if (result == AXDR_SUCCESS) result = framelog_encode_u64(codec, (uint64_t)entry->maxTime);
+    if (result == AXDR_SUCCESS) result = framelog_encode_u64(codec, entry->meterMask);
+    return result;
+}
+
+static int framelog_decode_entry(AXDR_CODEC* codec, AXDR_FRAMELOG_INDEX_ENTRY* entry) {
+    uint64_t minTime = 0, maxTime = 0;
+    int result = framelog_decode_u64(codec, &entry->offset);
+    if (result == AXDR_SUCCESS) result = axdr_decode_unsigned(codec, &entry->length, UINT32_MAX);
+    if (result == AXDR_SUCCESS) result = axdr_decode_unsigned(codec, &entry->count, UINT32_MAX);
+    if (result == AXDR_SUCCESS) result = framelog_decode_u64(codec, &minTime);
+    if (result == AXDR_SUCCESS) result = framelog_decode_u64(codec, &maxTime);
+    if (result == AXDR_SUCCESS) result = framelog_decode_u64(codec, &entry->meterMask);
+    entry->minTime = (int64_t)minTime;
+    entry->maxTime = (int64_t)maxTime;
+    return result;
+}
+
+// 解析块头，校验魔数和长度，返回块内负载的CRC
+static int framelog_decode_block_header(const uint8_t* header, size_t blockSize,
+                                        AXDR_FRAMELOG_INDEX_ENTRY* entry, uint32_t* crc) {
+    AXDR_CODEC codec;
+    axdr_codec_attach(&codec, (uint8_t*)header, FRAMELOG_BLOCK_HEADER);
+
+    uint32_t magic, payloadLength;
+    uint64_t minTime = 0, maxTime = 0;
+    int result = axdr_decode_unsigned(&codec, &magic, UINT32_MAX);
+    if (result == AXDR_SUCCESS) result = axdr_decode_unsigned(&codec, &entry->count, UINT32_MAX);
+    if (result == AXDR_SUCCESS) result = axdr_decode_unsigned(&codec, &payloadLength,
+                                                              (uint32_t)(blockSize - FRAMELOG_BLOCK_HEADER));
+    if (result == AXDR_SUCCESS) result = axdr_decode_unsigned(&codec, crc, UINT32_MAX);
+    if (result == AXDR_SUCCESS) result = framelog_decode_u64(&codec, &minTime);
+    if (result == AXDR_SUCCESS) result = framelog_decode_u64(&codec, &maxTime);
+    if (result == AXDR_SUCCESS) result = framelog_decode_u64(&codec, &entry->meterMask);
+    if (result != AXDR_SUCCESS) {
+        return result;
+    }
+    if (magic != FRAMELOG_BLOCK_MAGIC) {
+        return AXDR_ERROR_INVALID_VALUE;
+    }
+
+    entry->length = FRAMELOG_BLOCK_HEADER + payloadLength;
+    entry->minTime = (int64_t)minTime;
+    entry->maxTime = (int64_t)maxTime;
+    return AXDR_SUCCESS;
+}
+
+static int framelog_read_file_header(int fd, size_t* blockSize) {
+    uint8_t header[FRAMELOG_FILE_HEADER];
+    int result = framelog_pread(fd, header, sizeof(header), 0);
+    if (result != AXDR_SUCCESS) {
+        return result;
+    }
+
+    AXDR_CODEC codec;
+    axdr_codec_attach(&codec, header, sizeof(header));
+    uint32_t magic, version, size;
+    result = axdr_decode_unsigned(&codec, &magic, UINT32_MAX);
+    if (result == AXDR_SUCCESS) result = axdr_decode_unsigned(&codec, &version, UINT32_MAX);
+    if (result == AXDR_SUCCESS) result = axdr_decode_unsigned(&codec, &size, UINT32_MAX);
+    if (result != AXDR_SUCCESS) {
+        return result;
+    }
+    if (magic != FRAMELOG_FILE_MAGIC || version != FRAMELOG_VERSION ||
+        size <= FRAMELOG_BLOCK_HEADER + FRAMELOG_RECORD_HEADER) {
+        return AXDR_ERROR_INVALID_VALUE;
+    }
+
+    *blockSize = size;
+    return AXDR_SUCCESS;
+}
+
+// 加载索引：先读索引文件中与数据文件一致的部分，再扫描其后未建索引的数据块。
+// indexed 返回索引文件中有效的项数，end 返回最后一个完整数据块的结束偏移。
+static int framelog_load_index(int fd, const char* path, size_t blockSize, uint8_t* block,
+                               AXDR_FRAMELOG_INDEX_ENTRY** entries, size_t* count,
+                               size_t* indexed, uint64_t* end) {
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        return AXDR_ERROR_INVALID_VALUE;
+    }
+    uint64_t fileSize = (uint64_t)st.st_size;
+
+    size_t capacity = 64;
+    AXDR_FRAMELOG_INDEX_ENTRY* list = (AXDR_FRAMELOG_INDEX_ENTRY*)malloc(capacity * sizeof(*list));
+    if (!list) {
+        return AXDR_ERROR_BUFFER_OVERFLOW;
+    }
+    size_t n = 0;
+    uint64_t offset = FRAMELOG_FILE_HEADER;
+
+    char indexPath[4096];
+    framelog_index_path(indexPath, sizeof(indexPath), path);
+    int indexFd = open(indexPath, O_RDONLY | O_CLOEXEC);
+    if (indexFd >= 0) {
+        uint8_t raw[FRAMELOG_INDEX_ENTRY];
+        AXDR_CODEC codec;
+        uint32_t magic = 0, version = 0;
+        axdr_codec_attach(&codec, raw, FRAMELOG_INDEX_HEADER);
+        if (framelog_pread(indexFd, raw, FRAMELOG_INDEX_HEADER, 0) == AXDR_SUCCESS &&
+            axdr_decode_unsigned(&codec, &magic, UINT32_MAX) == AXDR_SUCCESS &&
+            axdr_decode_unsigned(&codec, &version, UINT32_MAX) == AXDR_SUCCESS &&
+            magic == FRAMELOG_INDEX_MAGIC && version == FRAMELOG_VERSION) {
+            uint64_t at = FRAMELOG_INDEX_HEADER;
+            while (framelog_pread(indexFd, raw, sizeof(raw), at) == AXDR_SUCCESS) {
+                AXDR_FRAMELOG_INDEX_ENTRY entry;
+                axdr_codec_attach(&codec, raw, sizeof(raw));
+                if (framelog_decode_entry(&codec, &entry) != AXDR_SUCCESS ||
+                    entry.offset != offset || entry.length > blockSize ||
+                    entry.length < FRAMELOG_BLOCK_HEADER ||
+                    entry.offset + entry.length > fileSize) {
+                    break;
+                }
+                if (n == capacity) {
+                    capacity *= 2;
+                    AXDR_FRAMELOG_INDEX_ENTRY* grown =
+                        (AXDR_FRAMELOG_INDEX_ENTRY*)realloc(list, capacity * sizeof(*list));
+                    if (!grown) {
+                        close(indexFd);
+                        free(list);
+                        return AXDR_ERROR_BUFFER_OVERFLOW;
+                    }
+                    list = grown;
+                }
+                list[n++] = entry;
+                offset += entry.length;
+                at += FRAMELOG_INDEX_ENTRY;
+            }
+        }
+        close(indexFd);
+    }
+    *indexed = n;
+
+    // 扫描索引之后的数据块，遇到不完整或校验失败的块即停止
+    while (offset + FRAMELOG_BLOCK_HEADER <= fileSize) {
+        AXDR_FRAMELOG_INDEX_ENTRY entry;
+        uint32_t crc;
+        if (framelog_pread(fd, block, FRAMELOG_BLOCK_HEADER, offset) != AXDR_SUCCESS ||
+            framelog_decode_block_header(block, blockSize, &entry, &crc) != AXDR_SUCCESS ||
+            offset + entry.length > fileSize ||
+            framelog_pread(fd, block + FRAMELOG_BLOCK_HEADER, entry.length - FRAMELOG_BLOCK_HEADER,
+                           offset + FRAMELOG_BLOCK_HEADER) != AXDR_SUCCESS ||
+            axdr_crc32(block + FRAMELOG_BLOCK_HEADER, entry.length - FRAMELOG_BLOCK_HEADER) != crc) {
+            break;
+        }
+        entry.offset = offset;
+        if (n == capacity) {
+            capacity *= 2;
+            AXDR_FRAMELOG_INDEX_ENTRY* grown =
+                (AXDR_FRAMELOG_INDEX_ENTRY*)realloc(list, capacity * sizeof(*list));
+            if (!grown) {
+                free(list);
+                return AXDR_ERROR_BUFFER_OVERFLOW;
+            }
+            list = grown;
+        }
+        list[n++] = entry;
+        offset += entry.length;
+    }
+
+    *entries = list;
+    *count = n;
+    *end = offset;
+    return AXDR_SUCCESS;
+}
+
+static void framelog_reset_block(AXDR_FRAMELOG_WRITER* writer) {
+    axdr_codec_attach(&writer->codec, writer->block, writer->blockSize);
+    writer->codec.position = FRAMELOG_BLOCK_HEADER;
+    memset(&writer->current, 0, sizeof(writer->current));
+}
+
+// 写入器实现
+AXDR_FRAMELOG_WRITER* axdr_framelog_writer_open(const char* path, size_t blockSize, unsigned syncEvery) {
+    if (!path) {
+        return NULL;
+    }
+    if (blockSize == 0) {
+        blockSize = AXDR_FRAMELOG_DEFAULT_BLOCK_SIZE;
+    }
+    if (blockSize <= FRAMELOG_BLOCK_HEADER + FRAMELOG_RECORD_HEADER || blockSize > UINT32_MAX) {
+        return NULL;
+    }
+
+    AXDR_FRAMELOG_WRITER* writer = (AXDR_FRAMELOG_WRITER*)calloc(1, sizeof(AXDR_FRAMELOG_WRITER));
+    if (!writer) {
+        return NULL;
+    }
+    writer->indexFd = -1;
+    writer->syncEvery = syncEvery;
+
+    char indexPath[4096];
+    framelog_index_path(indexPath, sizeof(indexPath), path);
+    AXDR_FRAMELOG_INDEX_ENTRY* entries = NULL;
+
+    writer->fd = open(path, O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    if (writer->fd < 0) {
+        goto fail;
+    }
+
+    struct stat st;
+    if (fstat(writer->fd, &st) != 0) {
+        goto fail;
+    }
+
+    uint8_t header[FRAMELOG_INDEX_ENTRY];
+    AXDR_CODEC codec;
+    if (st.st_size == 0) {
+        // 新文件：写文件头和空索引
+        writer->blockSize = blockSize;
+        axdr_codec_attach(&codec, header, FRAMELOG_FILE_HEADER);
+        axdr_encode_unsigned(&codec, FRAMELOG_FILE_MAGIC, UINT32_MAX);
+        axdr_encode_unsigned(&codec, FRAMELOG_VERSION, UINT32_MAX);
+        axdr_encode_unsigned(&codec, (uint32_t)blockSize, UINT32_MAX);
+        axdr_encode_unsigned(&codec, 0, UINT32_MAX);
+        if (framelog_pwrite(writer->fd, header, FRAMELOG_FILE_HEADER, 0) != AXDR_SUCCESS) {
+            goto fail;
+        }
+        writer->fileOffset = FRAMELOG_FILE_HEADER;
+
+        writer->indexFd = open(indexPath, O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+        axdr_codec_attach(&codec, header, FRAMELOG_INDEX_HEADER);
+        axdr_encode_unsigned(&codec, FRAMELOG_INDEX_MAGIC, UINT32_MAX);
+        axdr_encode_unsigned(&codec, FRAMELOG_VERSION, UINT32_MAX);
+        if (writer->indexFd < 0 ||
+            framelog_pwrite(writer->indexFd, header, FRAMELOG_INDEX_HEADER, 0) != AXDR_SUCCESS) {
+            goto fail;
+        }
+        writer->indexOffset = FRAMELOG_INDEX_HEADER;
+
+        writer->block = (uint8_t*)malloc(writer->blockSize);
+        if (!writer->block) {
+            goto fail;
+        }
+    } else {
+        // 已有文件：沿用文件中的块大小，丢弃末尾不完整的数据块并补齐索引
+        if (framelog_read_file_header(writer->fd, &writer->blockSize) != AXDR_SUCCESS) {
+            goto fail;
+        }
+        writer->block = (uint8_t*)malloc(writer->blockSize);
+        if (!writer->block) {
+            goto fail;
+        }
+
+        size_t count, indexed;
+        if (framelog_load_index(writer->fd, path, writer->blockSize, writer->block,
+                                &entries, &count, &indexed, &writer->fileOffset) != AXDR_SUCCESS ||
+            ftruncate(writer->fd, (off_t)writer->fileOffset) != 0) {
+            goto fail;
+        }
+
+        writer->indexFd = open(indexPath, O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+        if (writer->indexFd < 0) {
+            goto fail;
+        }
+        if (indexed == 0) {
+            axdr_codec_attach(&codec, header, FRAMELOG_INDEX_HEADER);
+            axdr_encode_unsigned(&codec, FRAMELOG_INDEX_MAGIC, UINT32_MAX);
+            axdr_encode_unsigned(&codec, FRAMELOG_VERSION, UINT32_MAX);
+            if (framelog_pwrite(writer->indexFd, header, FRAMELOG_INDEX_HEADER, 0) != AXDR_SUCCESS) {
+                goto fail;
+            }
+        }
+        writer->indexOffset = FRAMELOG_INDEX_HEADER + (uint64_t)indexed * FRAMELOG_INDEX_ENTRY;
+        for (size_t i = indexed; i < count; i++) {
+            axdr_codec_attach(&codec, header, FRAMELOG_INDEX_ENTRY);
+            framelog_encode_entry(&codec, &entries[i]);
+            if (framelog_pwrite(writer->indexFd, header, FRAMELOG_INDEX_ENTRY, writer->indexOffset) != AXDR_SUCCESS) {
+                goto fail;
+            }
+            writer->indexOffset += FRAMELOG_INDEX_ENTRY;
+        }
+        if (ftruncate(writer->indexFd, (off_t)writer->indexOffset) != 0) {
+            goto fail;
+        }
+        free(entries);
+        entries = NULL;
+    }
+
+    framelog_reset_block(writer);
+    return writer;
+
+fail:
+    free(entries);
+    free(writer->block);
+    if (writer->fd >= 0) {
+        close(writer->fd);
+    }
+    if (writer->indexFd >= 0) {
+        close(writer->indexFd);
+    }
+    free(writer);
+    return NULL;
+}
+
+int axdr_framelog_append(AXDR_FRAMELOG_WRITER* writer, uint32_t meterId, int64_t timestamp,
+                         const uint8_t* frame, size_t length) {
+    if (!writer || (!frame && length > 0)) {
+        return AXDR_ERROR_INVALID_VALUE;
+    }
+    if (length > writer->blockSize - FRAMELOG_BLOCK_HEADER - FRAMELOG_RECORD_HEADER) {
+        return AXDR_ERROR_INVALID_LENGTH;
+    }
+
+    if (writer->codec.position + FRAMELOG_RECORD_HEADER + length > writer->codec.size) {
+        int result = axdr_framelog_flush(writer);
+        if (result != AXDR_SUCCESS) {
+            return result;
+        }
+    }
+
+    // 记录：表号、时间戳、帧内容（字节串，自带长度前缀）
+    axdr_encode_unsigned(&writer->codec, meterId, UINT32_MAX);
+    framelog_encode_u64(&writer->codec, (uint64_t)timestamp);
+    axdr_encode_octet_string(&writer->codec, frame, length);
+
+    AXDR_FRAMELOG_INDEX_ENTRY* current = &writer->current;
+    if (current->count == 0 || timestamp < current->minTime) {
+        current->minTime = timestamp;
+    }
+    if (current->count == 0 || timestamp > current->maxTime) {
+        current->maxTime = timestamp;
+    }
+    current->meterMask |= framelog_meter_bit(meterId);
+    current->count++;
+    return AXDR_SUCCESS;
+}
+
+int axdr_framelog_flush(AXDR_FRAMELOG_WRITER* writer) {
+    if (!writer) {
+        return AXDR_ERROR_INVALID_VALUE;
+    }
+    if (writer->current.count == 0) {
+        return AXDR_SUCCESS;
+    }
+
+    AXDR_FRAMELOG_INDEX_ENTRY* current = &writer->current;
+    size_t payloadLength = writer->codec.position - FRAMELOG_BLOCK_HEADER;
+    current->offset = writer->fileOffset;
+    current->length = (uint32_t)writer->codec.position;
+
+    AXDR_CODEC header;
+    axdr_codec_attach(&header, writer->block, FRAMELOG_BLOCK_HEADER);
+    axdr_encode_unsigned(&header, FRAMELOG_BLOCK_MAGIC, UINT32_MAX);
+    axdr_encode_unsigned(&header, current->count, UINT32_MAX);
+    axdr_encode_unsigned(&header, (uint32_t)payloadLength, UINT32_MAX);
+    axdr_encode_unsigned(&header, axdr_crc32(writer->block + FRAMELOG_BLOCK_HEADER, payloadLength), UINT32_MAX);
+    framelog_encode_u64(&header, (uint64_t)current->minTime);
+    framelog_encode_u64(&header, (uint64_t)current->maxTime);
+    framelog_encode_u64(&header, current->meterMask);
+
+    int result = framelog_pwrite(writer->fd, writer->block, current->length, writer->fileOffset);
+    if (result != AXDR_SUCCESS) {
+        return result;
+    }
+
+    uint8_t raw[FRAMELOG_INDEX_ENTRY];
+    AXDR_CODEC codec;
+    axdr_codec_attach(&codec, raw, sizeof(raw));
+    framelog_encode_entry(&codec, current);
+    result = framelog_pwrite(writer->indexFd, raw, sizeof(raw), writer->indexOffset);
+    if (result != AXDR_SUCCESS) {
+        return result;
+    }
+
+    writer->fileOffset += current->length;
+    writer->indexOffset += FRAMELOG_INDEX_ENTRY;
+    framelog_reset_block(writer);
+
+    // 批量同步：每 syncEvery 个数据块执行一次 fdatasync
+    writer->unsynced++;
+    if (writer->syncEvery > 0 && writer->unsynced >= writer->syncEvery) {
+        return axdr_framelog_sync(writer);
+    }
+    return AXDR_SUCCESS;
+}
+
+int axdr_framelog_sync(AXDR_FRAMELOG_WRITER* writer) {
+    if (!writer) {
+        return AXDR_ERROR_INVALID_VALUE;
+    }
+    // 先同步数据再同步索引；崩溃后多出的索引项会因超出数据文件而被丢弃
+    if (fdatasync(writer->fd) != 0 || fdatasync(writer->indexFd) != 0) {
+        return AXDR_ERROR_BUFFER_OVERFLOW;
+    }
+    writer->unsynced = 0;
+    return AXDR_SUCCESS;
+}
+
+int axdr_framelog_writer_close(AXDR_FRAMELOG_WRITER* writer) {
+    if (!writer) {
+        return AXDR_ERROR_INVALID_VALUE;
+    }
+
+    int result = axdr_framelog_flush(writer);
+    if (result == AXDR_SUCCESS && writer->unsynced > 0) {
+        result = axdr_framelog_sync(writer);
+    }
+
+    close(writer->fd);
+    close(writer->indexFd);
+    free(writer->block);
+    free(writer);
+    return result;
+}
+
+// 读取器实现
+AXDR_FRAMELOG_READER* axdr_framelog_reader_open(const char* path) {
+    if (!path) {
+        return NULL;
+    }
+
+    AXDR_FRAMELOG_READER* reader = (AXDR_FRAMELOG_READER*)calloc(1, sizeof(AXDR_FRAMELOG_READER));
+    if (!reader) {
+        return NULL;
+    }
+
+    size_t indexed;
+    uint64_t end;
+    reader->fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (reader->fd < 0 ||
+        framelog_read_file_header(reader->fd, &reader->blockSize) != AXDR_SUCCESS ||
+        !(reader->block = (uint8_t*)malloc(reader->blockSize)) ||
+        framelog_load_index(reader->fd, path, reader->blockSize, reader->block,
+                            &reader->entries, &reader->count, &indexed, &end) != AXDR_SUCCESS) {
+        axdr_framelog_reader_close(reader);
+        return NULL;
+    }
+
+    size_t n = reader->count > 0 ? reader->count : 1;
+    reader->maxTimeSoFar = (int64_t*)malloc(n * sizeof(int64_t));
+    reader->minTimeAfter = (int64_t*)malloc(n * sizeof(int64_t));
+    if (!reader->maxTimeSoFar || !reader->minTimeAfter) {
+        axdr_framelog_reader_close(reader);
+        return NULL;
+    }
+
+    for (size_t i = 0; i < reader->count; i++) {
+        int64_t t = reader->entries[i].maxTime;
+        reader->maxTimeSoFar[i] = (i > 0 && reader->maxTimeSoFar[i - 1] > t) ? reader->maxTimeSoFar[i - 1] : t;
+    }
+    for (size_t i = reader->count; i-- > 0;) {
+        int64_t t = reader->entries[i].minTime;
+        reader->minTimeAfter[i] = (i + 1 < reader->count && reader->minTimeAfter[i + 1] < t) ? reader->minTimeAfter[i + 1] : t;
+    }
+    return reader;
+}
+
+int axdr_framelog_query(AXDR_FRAMELOG_READER* reader, uint32_t meterId, int64_t from, int64_t to,
+                        AXDR_FRAMELOG_VISITOR visitor, void* ctx) {
+    if (!reader || !visitor) {
+        return AXDR_ERROR_INVALID_VALUE;
+    }
+
+    // 二分查找第一个可能包含 from 之后记录的数据块
+    size_t lo = 0, hi = reader->count;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (reader->maxTimeSoFar[mid] < from) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+
+    uint64_t meterBit = meterId == AXDR_FRAMELOG_ANY_METER ? ~0ull : framelog_meter_bit(meterId);
+    for (size_t i = lo; i < reader->count && reader->minTimeAfter[i] <= to; i++) {
+        const AXDR_FRAMELOG_INDEX_ENTRY* entry = &reader->entries[i];
+        if (entry->minTime > to || entry->maxTime < from || !(entry->meterMask & meterBit)) {
+            continue;
+        }
+
+        AXDR_FRAMELOG_INDEX_ENTRY header;
+        uint32_t crc;
+        int result = framelog_pread(reader->fd, reader->block, entry->length, entry->offset);
+        if (result == AXDR_SUCCESS) {
+            result = framelog_decode_block_header(reader->block, reader->blockSize, &header, &crc);
+        }
+        if (result != AXDR_SUCCESS) {
+            return result;
+        }
+        if (header.length != entry->length ||
+            axdr_crc32(reader->block + FRAMELOG_BLOCK_HEADER, entry->length - FRAMELOG_BLOCK_HEADER) != crc) {
+            return AXDR_ERROR_CHECKSUM;
+        }
+
+        AXDR_CODEC codec;
+        axdr_codec_attach(&codec, reader->block, entry->length);
+        codec.position = FRAMELOG_BLOCK_HEADER;
+        for (uint32_t r = 0; r < header.count; r++) {
+            uint32_t id, length;
+            uint64_t timestamp;
+            result = axdr_decode_unsigned(&codec, &id, UINT32_MAX);
+            if (result == AXDR_SUCCESS) result = framelog_decode_u64(&codec, &timestamp);
+            if (result == AXDR_SUCCESS) result = axdr_decode_unsigned(&codec, &length, UINT32_MAX);
+            if (result == AXDR_SUCCESS && codec.position + length > codec.size) {
+                result = AXDR_ERROR_INVALID_LENGTH;
+            }
+            if (result != AXDR_SUCCESS) {
+                return result;
+            }
+
+            AXDR_CODEC frame;
+            axdr_codec_attach(&frame, reader->block + codec.position, length);
+            codec.position += length;
+
+            if ((int64_t)timestamp < from || (int64_t)timestamp > to ||
+                (meterId != AXDR_FRAMELOG_ANY_METER && id != meterId)) {
+                continue;
+            }
+            result = visitor(ctx, id, (int64_t)timestamp, &frame);
+            if (result != AXDR_SUCCESS) {
+                return result;
+            }
+        }
+    }
+
+    return AXDR_SUCCESS;
+}
+
+void axdr_framelog_reader_close(AXDR_FRAMELOG_READER* reader) {
+    if (!reader) {
+        return;
+    }
+    if (reader->fd >= 0) {
+        close(reader->fd);
+    }
+    free(reader->block);
+    free(reader->entries);
+    free(reader->maxTimeSoFar);
+    free(reader->minTimeAfter);
+    free(reader);
+}
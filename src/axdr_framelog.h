@@ -0,0 +1,78 @@
+#ifndef AXDR_FRAMELOG_H
+#define AXDR_FRAMELOG_H
+
+#include "axdr.h"
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// 追加写入的A-XDR帧日志
+//
+// 数据文件：文件头 + 若干数据块，每个数据块带块头（记录数、时间范围、表号掩码、CRC-32），
+// 块内为长度前缀的记录（长度、表号、时间戳、帧内容）。
+// 索引文件（<path>.idx）：每个数据块一条索引项，按时间与表号稀疏索引。
+// 所有整数按A-XDR大端序编码。
+
+#define AXDR_FRAMELOG_DEFAULT_BLOCK_SIZE  (64 * 1024)
+#define AXDR_FRAMELOG_ANY_METER           UINT32_MAX   // 查询时不按表号过滤
+
+// 每个数据块的索引项
+typedef struct {
+    uint64_t offset;        // 数据块在文件中的偏移
+    uint32_t length;        // 数据块总长度（含块头）
+    uint32_t count;         // 记录个数
+    int64_t  minTime;       // 块内最小时间戳
+    int64_t  maxTime;       // 块内最大时间戳
+    uint64_t meterMask;     // 块内表号的哈希位图
+} AXDR_FRAMELOG_INDEX_ENTRY;
+
+// 写入器
+typedef struct {
+    int        fd;              // 数据文件
+    int        indexFd;         // 索引文件
+    uint8_t*   block;           // 当前数据块缓冲区
+    size_t     blockSize;       // 数据块大小
+    AXDR_CODEC codec;           // 在 block 上编码记录
+    uint64_t   fileOffset;      // 下一个数据块的写入偏移
+    uint64_t   indexOffset;     // 下一条索引项的写入偏移
+    AXDR_FRAMELOG_INDEX_ENTRY current;  // 当前数据块的统计信息
+    unsigned   syncEvery;       // 每写入多少个数据块执行一次 fdatasync
+    unsigned   unsynced;        // 尚未同步的数据块个数
+} AXDR_FRAMELOG_WRITER;
+
+// 读取器
+typedef struct {
+    int        fd;
+    uint8_t*   block;           // 数据块读缓冲区
+    size_t     blockSize;
+    AXDR_FRAMELOG_INDEX_ENTRY* entries;
+    int64_t*   maxTimeSoFar;    // entries[0..i] 的最大时间戳，单调不减，用于二分查找
+    int64_t*   minTimeAfter;    // entries[i..] 的最小时间戳，用于提前结束扫描
+    size_t     count;
+} AXDR_FRAMELOG_READER;
+
+// 查询回调：frame 是指向数据块缓冲区的只读视图，回调返回后失效
+// 返回 AXDR_SUCCESS 继续遍历，其他值终止查询并作为查询结果返回
+typedef int (*AXDR_FRAMELOG_VISITOR)(void* ctx, uint32_t meterId, int64_t timestamp, AXDR_CODEC* frame);
+
+// 写入器：文件已存在时在其后追加，末尾不完整的数据块会被丢弃
+AXDR_FRAMELOG_WRITER* axdr_framelog_writer_open(const char* path, size_t blockSize, unsigned syncEvery);
+int axdr_framelog_append(AXDR_FRAMELOG_WRITER* writer, uint32_t meterId, int64_t timestamp,
+                         const uint8_t* frame, size_t length);
+int axdr_framelog_flush(AXDR_FRAMELOG_WRITER* writer);
+int axdr_framelog_sync(AXDR_FRAMELOG_WRITER* writer);
+int axdr_framelog_writer_close(AXDR_FRAMELOG_WRITER* writer);
+
+// 读取器：索引缺失或落后于数据文件时，扫描数据文件补齐
+AXDR_FRAMELOG_READER* axdr_framelog_reader_open(const char* path);
+int axdr_framelog_query(AXDR_FRAMELOG_READER* reader, uint32_t meterId, int64_t from, int64_t to,
+                        AXDR_FRAMELOG_VISITOR visitor, void* ctx);
+void axdr_framelog_reader_close(AXDR_FRAMELOG_READER* reader);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // AXDR_FRAMELOG_H
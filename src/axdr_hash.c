@@ -0,0 +1,66 @@
+#include "axdr_hash.h"
+#include <string.h>
+
+#define HASH_P0  0xa0761d6478bd642full
+#define HASH_P1  0xe7037ed1a0b428dbull
+#define HASH_P2  0x8ebc6af09c88c6e3ull
+
+// 64x64->128 乘法后高低位异或，作为混合函数
+static inline uint64_t hash_mix(uint64_t a, uint64_t b) {
+    __uint128_t r = (__uint128_t)a * b;
+    return (uint64_t)r ^ (uint64_t)(r >> 64);
+}
+
+static inline uint64_t hash_read64(const uint8_t* p) {
+    uint64_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+static inline uint64_t hash_read32(const uint8_t* p) {
+    uint32_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+uint64_t axdr_hash64(const void* data, size_t length, uint64_t seed) {
+    const uint8_t* p = (const uint8_t*)data;
+    uint64_t a, b;
+    seed ^= HASH_P0;
+
+    if (length <= 16) {
+        if (length >= 4) {
+            // 首尾重叠读取，覆盖 4..16 字节
+            a = (hash_read32(p) << 32) | hash_read32(p + ((length >> 3) << 2));
+            b = (hash_read32(p + length - 4) << 32) | hash_read32(p + length - 4 - ((length >> 3) << 2));
+        } else if (length > 0) {
+            a = ((uint64_t)p[0] << 16) | ((uint64_t)p[length >> 1] << 8) | p[length - 1];
+            b = 0;
+        } else {
+            a = b = 0;
+        }
+    } else {
+        size_t i = length;
+        if (i > 48) {
+            // 三路并行，减少依赖链
+            uint64_t s1 = seed, s2 = seed;
+            do {
+                seed = hash_mix(hash_read64(p) ^ HASH_P1, hash_read64(p + 8) ^ seed);
+                s1 = hash_mix(hash_read64(p + 16) ^ HASH_P2, hash_read64(p + 24) ^ s1);
+                s2 = hash_mix(hash_read64(p + 32) ^ HASH_P0, hash_read64(p + 40) ^ s2);
+                p += 48;
+                i -= 48;
+            } while (i > 48);
+            seed ^= s1 ^ s2;
+        }
+        while (i > 16) {
+            seed = hash_mix(hash_read64(p) ^ HASH_P1, hash_read64(p + 8) ^ seed);
+            p += 16;
+            i -= 16;
+        }
+        a = hash_read64(p + i - 16);
+        b = hash_read64(p + i - 8);
+    }
+
+    return hash_mix(HASH_P1 ^ length, hash_mix(a ^ HASH_P1, b ^ seed));
+}
@@ -0,0 +1,19 @@
+#ifndef AXDR_HASH_H
+#define AXDR_HASH_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// 快速64位非加密哈希，用于缓存键与帧指纹
+// 结果依赖平台字节序，只在进程内或同构节点之间比较，不作为持久化格式
+uint64_t axdr_hash64(const void* data, size_t length, uint64_t seed);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // AXDR_HASH_H
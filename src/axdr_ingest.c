@@ -0,0 +1,619 @@
+#define _GNU_SOURCE
+#include "axdr_ingest.h"
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/epoll.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+
+#if defined(__linux__) && defined(__NR_io_uring_setup)
+#include <linux/io_uring.h>
+#define AXDR_HAVE_IO_URING 1
+#endif
+
+#define INGEST_DEFAULT_FRAME_BUFFER  8192
+#define INGEST_DEFAULT_CHUNK_SIZE    4096
+#define INGEST_DEFAULT_CHUNK_COUNT   256
+#define INGEST_DEFAULT_BATCH         64
+
+// 常用帧长回调实现
+size_t axdr_ingest_length_prefixed(const uint8_t* data, size_t available) {
+    if (available < 4) {
+        return 0;
+    }
+    uint32_t length = ((uint32_t)data[0] << 24) | ((uint32_t)data[1] << 16) |
+                      ((uint32_t)data[2] << 8) | (uint32_t)data[3];
+    return (size_t)length + 4;
+}
+
+static int ingest_deliver(AXDR_INGEST* ingest, int id, const uint8_t* data, size_t length, int* frames) {
+    // 与上一帧指纹相同则不交付；无法计算指纹的帧照常交付，由解码报告错误
+    uint64_t fingerprint = 0;
+    if (ingest->fingerprints &&
+        axdr_fingerprint(ingest->config.fingerprint, data, length, &fingerprint) == AXDR_SUCCESS &&
+        axdr_fingerprint_table_check(ingest->fingerprints, (size_t)id, fingerprint) == 1) {
+        return AXDR_SUCCESS;
+    }
+
+    AXDR_CODEC frame;
+    axdr_codec_attach(&frame, (uint8_t*)data, length);
+    (*frames)++;
+    int result = ingest->config.handler(ingest->config.ctx, id, &frame);
+    if (result != AXDR_SUCCESS) {
+        axdr_fingerprint_table_forget(ingest->fingerprints, (size_t)id);
+    }
+    return result;
+}
+
+// 交付重组缓冲区中的完整帧，剩余的不完整帧移到缓冲区开头
+static void ingest_drain(AXDR_INGEST* ingest, int id, int* frames) {
+    AXDR_INGEST_SOURCE* source = &ingest->sources[id];
+    size_t capacity = ingest->config.frameBufferSize;
+    size_t offset = 0;
+
+    while (offset < source->fill) {
+        size_t length = ingest->config.frameLength(source->buffer + offset, source->fill - offset);
+        if (length == AXDR_INGEST_FRAME_INVALID || length > capacity) {
+            source->fill = 0;
+            return;
+        }
+        if (length == 0 || length > source->fill - offset) {
+            break;
+        }
+        if (ingest_deliver(ingest, id, source->buffer + offset, length, frames) != AXDR_SUCCESS) {
+            source->fill = 0;
+            return;
+        }
+        offset += length;
+    }
+
+    if (offset > 0) {
+        memmove(source->buffer, source->buffer + offset, source->fill - offset);
+        source->fill -= offset;
+    }
+    // 缓冲区已满仍无法确定帧长，重新同步
+    if (source->fill == capacity) {
+        source->fill = 0;
+    }
+}
+
+// 处理一次接收到的数据：整帧直接交付视图，跨接收的部分进入重组缓冲区
+static void ingest_consume(AXDR_INGEST* ingest, int id, const uint8_t* data, size_t length, int* frames) {
+    AXDR_INGEST_SOURCE* source = &ingest->sources[id];
+    size_t capacity = ingest->config.frameBufferSize;
+
+    while (length > 0) {
+        if (source->fill == 0) {
+            size_t frame = ingest->config.frameLength(data, length);
+            if (frame == AXDR_INGEST_FRAME_INVALID || frame > capacity) {
+                return;
+            }
+            if (frame > 0 && frame <= length) {
+                if (ingest_deliver(ingest, id, data, frame, frames) != AXDR_SUCCESS) {
+                    return;
+                }
+                data += frame;
+                length -= frame;
+                continue;
+            }
+        }
+
+        // 只拷贝补齐当前帧所需的字节，帧长未知时尽量多拷贝
+        size_t take = capacity - source->fill;
+        if (take > length) {
+            take = length;
+        }
+        if (source->fill > 0) {
+            size_t frame = ingest->config.frameLength(source->buffer, source->fill);
+            if (frame != 0 && frame != AXDR_INGEST_FRAME_INVALID &&
+                frame > source->fill && frame - source->fill < take) {
+                take = frame - source->fill;
+            }
+        }
+        memcpy(source->buffer + source->fill, data, take);
+        source->fill += take;
+        data += take;
+        length -= take;
+        ingest_drain(ingest, id, frames);
+    }
+}
+
+static void ingest_close_source(AXDR_INGEST* ingest, int id) {
+    AXDR_INGEST_SOURCE* source = &ingest->sources[id];
+    if (!source->active) {
+        return;
+    }
+    source->active = 0;
+    source->fill = 0;
+    axdr_fingerprint_table_forget(ingest->fingerprints, (size_t)id);
+    if (ingest->backend == AXDR_INGEST_EPOLL) {
+        epoll_ctl(ingest->epollFd, EPOLL_CTL_DEL, source->fd, NULL);
+    }
+    ingest->config.handler(ingest->config.ctx, id, NULL);
+}
+
+#ifdef AXDR_HAVE_IO_URING
+
+#define INGEST_CANCEL_TAG  UINT64_MAX
+#define INGEST_BUFFER_GROUP  0
+
+struct AXDR_INGEST_URING {
+    int       fd;
+    unsigned  sqEntries;
+    unsigned* sqHead;
+    unsigned* sqTail;
+    unsigned* sqMask;
+    unsigned* sqArray;
+    struct io_uring_sqe* sqes;
+    unsigned* cqHead;
+    unsigned* cqTail;
+    unsigned* cqMask;
+    struct io_uring_cqe* cqes;
+    void*     sqRing;
+    size_t    sqRingSize;
+    void*     cqRing;
+    size_t    cqRingSize;
+    size_t    sqesSize;
+    unsigned  pending;      // 已填写尚未提交的SQE个数
+
+    // 提供缓冲区环：内核为每次接收挑选一个缓冲区
+    struct io_uring_buf_ring* bufRing;
+    size_t    bufRingSize;
+    uint8_t*  chunks;
+    unsigned  bufTail;
+};
+
+static int uring_enter(int fd, unsigned submit, unsigned wait, unsigned flags, void* arg, size_t argSize) {
+    return (int)syscall(__NR_io_uring_enter, fd, submit, wait, flags, arg, argSize);
+}
+
+static void uring_destroy(struct AXDR_INGEST_URING* ring, size_t chunkBytes) {
+    if (!ring) {
+        return;
+    }
+    if (ring->chunks) munmap(ring->chunks, chunkBytes);
+    if (ring->bufRing) munmap(ring->bufRing, ring->bufRingSize);
+    if (ring->sqes) munmap(ring->sqes, ring->sqesSize);
+    if (ring->cqRing && ring->cqRing != ring->sqRing) munmap(ring->cqRing, ring->cqRingSize);
+    if (ring->sqRing) munmap(ring->sqRing, ring->sqRingSize);
+    if (ring->fd >= 0) close(ring->fd);
+    free(ring);
+}
+
+static void uring_recycle(AXDR_INGEST* ingest, unsigned bid) {
+    struct AXDR_INGEST_URING* ring = ingest->uring;
+    unsigned mask = ingest->config.chunkCount - 1;
+    struct io_uring_buf* buf = &ring->bufRing->bufs[ring->bufTail & mask];
+    buf->addr = (uint64_t)(uintptr_t)(ring->chunks + (size_t)bid * ingest->config.chunkSize);
+    buf->len = (uint32_t)ingest->config.chunkSize;
+    buf->bid = (uint16_t)bid;
+    ring->bufTail++;
+}
+
+static void uring_publish_buffers(struct AXDR_INGEST_URING* ring) {
+    __atomic_store_n(&ring->bufRing->tail, (uint16_t)ring->bufTail, __ATOMIC_RELEASE);
+}
+
+static struct AXDR_INGEST_URING* uring_create(const AXDR_INGEST_CONFIG* config) {
+    struct AXDR_INGEST_URING* ring = (struct AXDR_INGEST_URING*)calloc(1, sizeof(*ring));
+    if (!ring) {
+        return NULL;
+    }
+
+    struct io_uring_params params;
+    memset(&params, 0, sizeof(params));
+    unsigned entries = 64;
+    while (entries < config->maxSources * 2 && entries < 4096) {
+        entries *= 2;
+    }
+    ring->fd = (int)syscall(__NR_io_uring_setup, entries, &params);
+    if (ring->fd < 0) {
+        free(ring);
+        return NULL;
+    }
+    // 需要 EXT_ARG（带超时等待）
+    if (!(params.features & IORING_FEAT_EXT_ARG)) {
+        goto fail;
+    }
+
+    ring->sqEntries = params.sq_entries;
+    ring->sqRingSize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    ring->cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+    if (params.features & IORING_FEAT_SINGLE_MMAP) {
+        if (ring->cqRingSize > ring->sqRingSize) {
+            ring->sqRingSize = ring->cqRingSize;
+        }
+        ring->cqRingSize = ring->sqRingSize;
+    }
+
+    ring->sqRing = mmap(NULL, ring->sqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                        ring->fd, IORING_OFF_SQ_RING);
+    if (ring->sqRing == MAP_FAILED) {
+        ring->sqRing = NULL;
+        goto fail;
+    }
+    if (params.features & IORING_FEAT_SINGLE_MMAP) {
+        ring->cqRing = ring->sqRing;
+    } else {
+        ring->cqRing = mmap(NULL, ring->cqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                            ring->fd, IORING_OFF_CQ_RING);
+        if (ring->cqRing == MAP_FAILED) {
+            ring->cqRing = NULL;
+            goto fail;
+        }
+    }
+    ring->sqesSize = params.sq_entries * sizeof(struct io_uring_sqe);
+    ring->sqes = (struct io_uring_sqe*)mmap(NULL, ring->sqesSize, PROT_READ | PROT_WRITE,
+                                            MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_SQES);
+    if (ring->sqes == MAP_FAILED) {
+        ring->sqes = NULL;
+        goto fail;
+    }
+
+    uint8_t* sq = (uint8_t*)ring->sqRing;
+    uint8_t* cq = (uint8_t*)ring->cqRing;
+    ring->sqHead = (unsigned*)(sq + params.sq_off.head);
+    ring->sqTail = (unsigned*)(sq + params.sq_off.tail);
+    ring->sqMask = (unsigned*)(sq + params.sq_off.ring_mask);
+    ring->sqArray = (unsigned*)(sq + params.sq_off.array);
+    ring->cqHead = (unsigned*)(cq + params.cq_off.head);
+    ring->cqTail = (unsigned*)(cq + params.cq_off.tail);
+    ring->cqMask = (unsigned*)(cq + params.cq_off.ring_mask);
+    ring->cqes = (struct io_uring_cqe*)(cq + params.cq_off.cqes);
+
+    // 注册提供缓冲区环
+    size_t chunkBytes = (size_t)config->chunkCount * config->chunkSize;
+    ring->bufRingSize = config->chunkCount * sizeof(struct io_uring_buf);
+    ring->bufRing = (struct io_uring_buf_ring*)mmap(NULL, ring->bufRingSize, PROT_READ | PROT_WRITE,
+                                                    MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (ring->bufRing == MAP_FAILED) {
+        ring->bufRing = NULL;
+        goto fail;
+    }
+    ring->chunks = (uint8_t*)mmap(NULL, chunkBytes, PROT_READ | PROT_WRITE,
+                                  MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (ring->chunks == MAP_FAILED) {
+        ring->chunks = NULL;
+        goto fail;
+    }
+
+    struct io_uring_buf_reg reg;
+    memset(&reg, 0, sizeof(reg));
+    reg.ring_addr = (uint64_t)(uintptr_t)ring->bufRing;
+    reg.ring_entries = config->chunkCount;
+    reg.bgid = INGEST_BUFFER_GROUP;
+    if (syscall(__NR_io_uring_register, ring->fd, IORING_REGISTER_PBUF_RING, &reg, 1) != 0) {
+        goto fail;
+    }
+    return ring;
+
+fail:
+    uring_destroy(ring, (size_t)config->chunkCount * config->chunkSize);
+    return NULL;
+}
+
+static struct io_uring_sqe* uring_get_sqe(struct AXDR_INGEST_URING* ring) {
+    unsigned head = __atomic_load_n(ring->sqHead, __ATOMIC_ACQUIRE);
+    unsigned tail = *ring->sqTail;
+    if (tail - head >= ring->sqEntries) {
+        // 提交队列已满，先提交
+        if (uring_enter(ring->fd, ring->pending, 0, 0, NULL, 0) < 0) {
+            return NULL;
+        }
+        ring->pending = 0;
+        head = __atomic_load_n(ring->sqHead, __ATOMIC_ACQUIRE);
+        if (tail - head >= ring->sqEntries) {
+            return NULL;
+        }
+    }
+
+    unsigned index = tail & *ring->sqMask;
+    struct io_uring_sqe* sqe = &ring->sqes[index];
+    memset(sqe, 0, sizeof(*sqe));
+    ring->sqArray[index] = index;
+    __atomic_store_n(ring->sqTail, tail + 1, __ATOMIC_RELEASE);
+    ring->pending++;
+    return sqe;
+}
+
+static int uring_arm(AXDR_INGEST* ingest, int id) {
+    AXDR_INGEST_SOURCE* source = &ingest->sources[id];
+    struct io_uring_sqe* sqe = uring_get_sqe(ingest->uring);
+    if (!sqe) {
+        return AXDR_ERROR_BUFFER_OVERFLOW;
+    }
+
+    sqe->fd = source->fd;
+    sqe->flags = IOSQE_BUFFER_SELECT;
+    sqe->buf_group = INGEST_BUFFER_GROUP;
+    sqe->user_data = ((uint64_t)source->generation << 32) | (uint32_t)id;
+    if (source->useRead) {
+        // pty/串口：单次 read，每次完成后重新提交
+        sqe->opcode = IORING_OP_READ;
+        sqe->len = (uint32_t)ingest->config.chunkSize;
+        sqe->off = (uint64_t)-1;
+    } else {
+        // 套接字：multishot recv，一次提交持续产生完成事件
+        sqe->opcode = IORING_OP_RECV;
+        sqe->ioprio = IORING_RECV_MULTISHOT;
+    }
+    return AXDR_SUCCESS;
+}
+
+static int uring_cancel(AXDR_INGEST* ingest, int id) {
+    struct io_uring_sqe* sqe = uring_get_sqe(ingest->uring);
+    if (!sqe) {
+        return AXDR_ERROR_BUFFER_OVERFLOW;
+    }
+    sqe->opcode = IORING_OP_ASYNC_CANCEL;
+    sqe->fd = -1;
+    sqe->addr = ((uint64_t)ingest->sources[id].generation << 32) | (uint32_t)id;
+    sqe->user_data = INGEST_CANCEL_TAG;
+    return AXDR_SUCCESS;
+}
+
+static int uring_poll(AXDR_INGEST* ingest, int timeoutMs) {
+    struct AXDR_INGEST_URING* ring = ingest->uring;
+    struct __kernel_timespec ts;
+    struct io_uring_getevents_arg arg;
+    memset(&arg, 0, sizeof(arg));
+    if (timeoutMs >= 0) {
+        ts.tv_sec = timeoutMs / 1000;
+        ts.tv_nsec = (long long)(timeoutMs % 1000) * 1000000;
+        arg.ts = (uint64_t)(uintptr_t)&ts;
+    }
+
+    unsigned head = *ring->cqHead;
+    unsigned wait = (timeoutMs != 0 && head == __atomic_load_n(ring->cqTail, __ATOMIC_ACQUIRE)) ? 1 : 0;
+    if (ring->pending > 0 || wait) {
+        int res = uring_enter(ring->fd, ring->pending, wait,
+                              IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG, &arg, sizeof(arg));
+        if (res < 0 && errno != ETIME && errno != EINTR) {
+            return AXDR_ERROR_INVALID_VALUE;
+        }
+        if (res >= 0) {
+            ring->pending = 0;
+        }
+    }
+
+    int frames = 0;
+    unsigned tail = __atomic_load_n(ring->cqTail, __ATOMIC_ACQUIRE);
+    unsigned mask = *ring->cqMask;
+    unsigned handled = 0;
+    while (head != tail && handled < ingest->config.batchSize) {
+        struct io_uring_cqe* cqe = &ring->cqes[head & mask];
+        uint64_t userData = cqe->user_data;
+        int res = cqe->res;
+        unsigned flags = cqe->flags;
+        head++;
+        handled++;
+
+        if (userData == INGEST_CANCEL_TAG) {
+            continue;
+        }
+
+        int id = (int)(uint32_t)userData;
+        AXDR_INGEST_SOURCE* source = (size_t)id < ingest->config.maxSources ? &ingest->sources[id] : NULL;
+        int valid = source && source->active && source->generation == (uint32_t)(userData >> 32);
+
+        if (valid && res > 0 && (flags & IORING_CQE_F_BUFFER)) {
+            unsigned bid = flags >> IORING_CQE_BUFFER_SHIFT;
+            ingest_consume(ingest, id, ring->chunks + (size_t)bid * ingest->config.chunkSize,
+                           (size_t)res, &frames);
+        }
+        if (flags & IORING_CQE_F_BUFFER) {
+            uring_recycle(ingest, flags >> IORING_CQE_BUFFER_SHIFT);
+        }
+        if (!valid || !source->active) {
+            continue;
+        }
+
+        if (res == -ENOTSOCK && !source->useRead) {
+            source->useRead = 1;
+            uring_arm(ingest, id);
+        } else if (res == -ENOBUFS || res == -EINTR || res == -EAGAIN) {
+            uring_arm(ingest, id);
+        } else if (res <= 0) {
+            ingest_close_source(ingest, id);
+        } else if (!(flags & IORING_CQE_F_MORE)) {
+            uring_arm(ingest, id);
+        }
+    }
+
+    __atomic_store_n(ring->cqHead, head, __ATOMIC_RELEASE);
+    uring_publish_buffers(ring);
+    return frames;
+}
+
+#endif // AXDR_HAVE_IO_URING
+
+static int epoll_poll(AXDR_INGEST* ingest, int timeoutMs) {
+    struct epoll_event events[INGEST_DEFAULT_BATCH];
+    int maxEvents = ingest->config.batchSize < INGEST_DEFAULT_BATCH ? (int)ingest->config.batchSize : INGEST_DEFAULT_BATCH;
+    int n = epoll_wait(ingest->epollFd, events, maxEvents, timeoutMs);
+    if (n < 0) {
+        return errno == EINTR ? 0 : AXDR_ERROR_INVALID_VALUE;
+    }
+
+    int frames = 0;
+    size_t capacity = ingest->config.frameBufferSize;
+    for (int i = 0; i < n; i++) {
+        int id = (int)events[i].data.u32;
+        AXDR_INGEST_SOURCE* source = &ingest->sources[id];
+        if (!source->active) {
+            continue;
+        }
+
+        // 直接读入重组缓冲区，整帧在原地交付
+        ssize_t r = read(source->fd, source->buffer + source->fill, capacity - source->fill);
+        if (r > 0) {
+            source->fill += (size_t)r;
+            ingest_drain(ingest, id, &frames);
+        } else if (r == 0 || (errno != EAGAIN && errno != EINTR)) {
+            ingest_close_source(ingest, id);
+        }
+    }
+    return frames;
+}
+
+// 接收管线实现
+AXDR_INGEST* axdr_ingest_create(const AXDR_INGEST_CONFIG* config) {
+    if (!config || !config->frameLength || !config->handler || config->maxSources == 0) {
+        return NULL;
+    }
+
+    AXDR_INGEST* ingest = (AXDR_INGEST*)calloc(1, sizeof(AXDR_INGEST));
+    if (!ingest) {
+        return NULL;
+    }
+    ingest->config = *config;
+    ingest->epollFd = -1;
+    if (ingest->config.frameBufferSize == 0) ingest->config.frameBufferSize = INGEST_DEFAULT_FRAME_BUFFER;
+    if (ingest->config.chunkSize == 0) ingest->config.chunkSize = INGEST_DEFAULT_CHUNK_SIZE;
+    if (ingest->config.chunkCount == 0) ingest->config.chunkCount = INGEST_DEFAULT_CHUNK_COUNT;
+    if (ingest->config.batchSize == 0) ingest->config.batchSize = INGEST_DEFAULT_BATCH;
+    if ((ingest->config.chunkCount & (ingest->config.chunkCount - 1)) != 0 ||
+        ingest->config.chunkCount > 32768) {
+        free(ingest);
+        return NULL;
+    }
+
+    ingest->sources = (AXDR_INGEST_SOURCE*)calloc(config->maxSources, sizeof(AXDR_INGEST_SOURCE));
+    if (!ingest->sources) {
+        free(ingest);
+        return NULL;
+    }
+    if (config->fingerprint) {
+        ingest->fingerprints = axdr_fingerprint_table_create(config->maxSources);
+        if (!ingest->fingerprints) {
+            axdr_ingest_destroy(ingest);
+            return NULL;
+        }
+    }
+
+#ifdef AXDR_HAVE_IO_URING
+    if (config->backend != AXDR_INGEST_EPOLL) {
+        ingest->uring = uring_create(&ingest->config);
+        if (ingest->uring) {
+            for (unsigned i = 0; i < ingest->config.chunkCount; i++) {
+                uring_recycle(ingest, i);
+            }
+            uring_publish_buffers(ingest->uring);
+            ingest->backend = AXDR_INGEST_IO_URING;
+            return ingest;
+        }
+    }
+#endif
+    if (config->backend == AXDR_INGEST_IO_URING) {
+        axdr_ingest_destroy(ingest);
+        return NULL;
+    }
+
+    ingest->epollFd = epoll_create1(EPOLL_CLOEXEC);
+    if (ingest->epollFd < 0) {
+        axdr_ingest_destroy(ingest);
+        return NULL;
+    }
+    ingest->backend = AXDR_INGEST_EPOLL;
+    return ingest;
+}
+
+void axdr_ingest_destroy(AXDR_INGEST* ingest) {
+    if (!ingest) {
+        return;
+    }
+#ifdef AXDR_HAVE_IO_URING
+    uring_destroy(ingest->uring, (size_t)ingest->config.chunkCount * ingest->config.chunkSize);
+#endif
+    if (ingest->epollFd >= 0) {
+        close(ingest->epollFd);
+    }
+    for (size_t i = 0; i < ingest->config.maxSources; i++) {
+        free(ingest->sources[i].buffer);
+    }
+    free(ingest->sources);
+    axdr_fingerprint_table_destroy(ingest->fingerprints);
+    free(ingest);
+}
+
+int axdr_ingest_add(AXDR_INGEST* ingest, int fd) {
+    if (!ingest || fd < 0) {
+        return AXDR_ERROR_INVALID_VALUE;
+    }
+
+    size_t id = 0;
+    while (id < ingest->config.maxSources && ingest->sources[id].active) {
+        id++;
+    }
+    if (id == ingest->config.maxSources) {
+        return AXDR_ERROR_BUFFER_OVERFLOW;
+    }
+
+    AXDR_INGEST_SOURCE* source = &ingest->sources[id];
+    if (!source->buffer) {
+        source->buffer = (uint8_t*)malloc(ingest->config.frameBufferSize);
+        if (!source->buffer) {
+            return AXDR_ERROR_BUFFER_OVERFLOW;
+        }
+    }
+    source->fd = fd;
+    source->fill = 0;
+    source->useRead = 0;
+    axdr_fingerprint_table_forget(ingest->fingerprints, id);
+    source->generation++;
+    source->active = 1;
+
+#ifdef AXDR_HAVE_IO_URING
+    if (ingest->backend == AXDR_INGEST_IO_URING) {
+        if (uring_arm(ingest, (int)id) != AXDR_SUCCESS) {
+            source->active = 0;
+            return AXDR_ERROR_BUFFER_OVERFLOW;
+        }
+        return (int)id;
+    }
+#endif
+
+    struct epoll_event event;
+    memset(&event, 0, sizeof(event));
+    event.events = EPOLLIN;
+    event.data.u32 = (uint32_t)id;
+    if (epoll_ctl(ingest->epollFd, EPOLL_CTL_ADD, fd, &event) != 0) {
+        source->active = 0;
+        return AXDR_ERROR_INVALID_VALUE;
+    }
+    return (int)id;
+}
+
+int axdr_ingest_remove(AXDR_INGEST* ingest, int sourceId) {
+    if (!ingest || sourceId < 0 || (size_t)sourceId >= ingest->config.maxSources ||
+        !ingest->sources[sourceId].active) {
+        return AXDR_ERROR_INVALID_VALUE;
+    }
+
+    AXDR_INGEST_SOURCE* source = &ingest->sources[sourceId];
+    source->active = 0;
+    source->fill = 0;
+    axdr_fingerprint_table_forget(ingest->fingerprints, (size_t)sourceId);
+#ifdef AXDR_HAVE_IO_URING
+    if (ingest->backend == AXDR_INGEST_IO_URING) {
+        return uring_cancel(ingest, sourceId);
+    }
+#endif
+    epoll_ctl(ingest->epollFd, EPOLL_CTL_DEL, source->fd, NULL);
+    return AXDR_SUCCESS;
+}
+
+int axdr_ingest_poll(AXDR_INGEST* ingest, int timeoutMs) {
+    if (!ingest) {
+        return AXDR_ERROR_INVALID_VALUE;
+    }
+#ifdef AXDR_HAVE_IO_URING
+    if (ingest->backend == AXDR_INGEST_IO_URING) {
+        return uring_poll(ingest, timeoutMs);
+    }
+#endif
+    return epoll_poll(ingest, timeoutMs);
+}
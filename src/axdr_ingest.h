@@ -0,0 +1,88 @@
+#ifndef AXDR_INGEST_H
+#define AXDR_INGEST_H
+
+#include "axdr.h"
+#include "axdr_fingerprint.h"
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// 多路帧接收：从大量套接字/串口桥接设备批量读取数据，切分出完整帧后交给解码
+//
+// 优先使用 io_uring（提供缓冲区环 + multishot recv），不可用时退回 epoll。
+// 帧整段落在一次接收的数据中时直接以视图交付，不做拷贝；只有跨越多次接收的帧
+// 才在每个源的重组缓冲区中拼接。
+
+// 后端选择
+#define AXDR_INGEST_AUTO      0
+#define AXDR_INGEST_EPOLL     1
+#define AXDR_INGEST_IO_URING  2
+
+// 帧长回调的特殊返回值：数据无法成帧，丢弃已缓存的数据重新同步
+#define AXDR_INGEST_FRAME_INVALID  ((size_t)-1)
+
+// 根据已收到的数据计算完整帧的长度；数据不足以确定长度时返回0
+typedef size_t (*AXDR_FRAME_LENGTH)(const uint8_t* data, size_t available);
+
+// 完整帧回调：frame 为只读视图，回调返回后失效。
+// 源关闭（对端关闭或读出错）时以 frame == NULL 调用一次。
+// 返回非 AXDR_SUCCESS 表示帧无法解码，丢弃该源已缓存的数据重新同步。
+typedef int (*AXDR_FRAME_HANDLER)(void* ctx, int sourceId, AXDR_CODEC* frame);
+
+typedef struct {
+    int      backend;           // AXDR_INGEST_AUTO / EPOLL / IO_URING
+    size_t   maxSources;        // 最大源个数
+    size_t   frameBufferSize;   // 每个源的重组缓冲区大小，即最大帧长，0 使用默认值
+    size_t   chunkSize;         // io_uring 提供缓冲区大小，0 使用默认值
+    unsigned chunkCount;        // io_uring 提供缓冲区个数（2的幂），0 使用默认值
+    unsigned batchSize;         // 每次轮询最多处理的完成事件数，0 使用默认值
+    AXDR_FRAME_LENGTH  frameLength;
+    AXDR_FRAME_HANDLER handler;
+    void*    ctx;
+    // 非 NULL 时按指纹跳过与该源上一帧相同的帧，不调用 handler
+    const AXDR_FINGERPRINT_PLAN* fingerprint;
+} AXDR_INGEST_CONFIG;
+
+// 单个数据源
+typedef struct {
+    int      fd;            // 调用者拥有的文件描述符
+    int      active;        // 是否在接收中
+    int      useRead;       // 非套接字（pty/串口）使用 read 代替 recv
+    uint32_t generation;    // 复用槽位时区分过期的完成事件
+    uint8_t* buffer;        // 重组缓冲区
+    size_t   fill;          // 重组缓冲区中已有的字节数
+} AXDR_INGEST_SOURCE;
+
+struct AXDR_INGEST_URING;
+
+typedef struct {
+    AXDR_INGEST_CONFIG  config;
+    int                 backend;    // 实际使用的后端
+    AXDR_INGEST_SOURCE* sources;
+    int                 epollFd;
+    struct AXDR_INGEST_URING* uring;
+    AXDR_FINGERPRINT_TABLE* fingerprints;  // 配置了指纹时按源记录上一帧指纹及跳过次数
+} AXDR_INGEST;
+
+AXDR_INGEST* axdr_ingest_create(const AXDR_INGEST_CONFIG* config);
+void axdr_ingest_destroy(AXDR_INGEST* ingest);
+
+// 添加数据源，返回源编号（>= 0）或错误码
+int axdr_ingest_add(AXDR_INGEST* ingest, int fd);
+// 停止接收某个源；文件描述符仍由调用者关闭
+int axdr_ingest_remove(AXDR_INGEST* ingest, int sourceId);
+
+// 等待并处理一批接收事件，timeoutMs < 0 表示一直等待
+// 返回本次交付的完整帧个数（不含因指纹相同而跳过的帧），或错误码
+int axdr_ingest_poll(AXDR_INGEST* ingest, int timeoutMs);
+
+// 常用的帧长回调：4字节A-XDR无符号长度前缀 + 负载
+size_t axdr_ingest_length_prefixed(const uint8_t* data, size_t available);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // AXDR_INGEST_H
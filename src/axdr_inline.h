@@ -0,0 +1,191 @@
+#ifndef AXDR_INLINE_H
+#define AXDR_INLINE_H
+
+// 定长基本类型编解码的实现
+//
+// 默认由 axdr.c 以外部函数的形式编译进库；定义 AXDR_INLINE_PRIMITIVES 时由 axdr.h
+// 以 static inline 的形式包含，调用处可以内联并在编译期折叠常量约束（min/max/count）。
+// 不要直接包含本文件，请包含 axdr.h。
+
+#ifndef AXDR_PRIMITIVE
+#error "axdr_inline.h must be included through axdr.h"
+#endif
+
+#include <string.h>
+
+// 整数编码实现
+AXDR_PRIMITIVE int axdr_encode_integer(AXDR_CODEC* codec, int32_t value, int32_t min, int32_t max) {
+    // 约束检查
+    if (value < min || value > max) {
+        return AXDR_ERROR_CONSTRAINT;
+    }
+    
+    // 确保缓冲区足够
+    if (codec->position + 4 > codec->size) {
+        return AXDR_ERROR_BUFFER_OVERFLOW;
+    }
+    
+    // 网络字节序编码（大端序）
+    codec->buffer[codec->position++] = (value >> 24) & 0xFF;
+    codec->buffer[codec->position++] = (value >> 16) & 0xFF;
+    codec->buffer[codec->position++] = (value >> 8) & 0xFF;
+    codec->buffer[codec->position++] = value & 0xFF;
+    axdr_checksum_fold(codec);
+    
+    return AXDR_SUCCESS;
+}
+
+// 无符号整数编码实现
+AXDR_PRIMITIVE int axdr_encode_unsigned(AXDR_CODEC* codec, uint32_t value, uint32_t max) {
+    // 约束检查
+    if (value > max) {
+        return AXDR_ERROR_CONSTRAINT;
+    }
+    
+    // 确保缓冲区足够
+    if (codec->position + 4 > codec->size) {
+        return AXDR_ERROR_BUFFER_OVERFLOW;
+    }
+    
+    // 网络字节序编码
+    codec->buffer[codec->position++] = (value >> 24) & 0xFF;
+    codec->buffer[codec->position++] = (value >> 16) & 0xFF;
+    codec->buffer[codec->position++] = (value >> 8) & 0xFF;
+    codec->buffer[codec->position++] = value & 0xFF;
+    axdr_checksum_fold(codec);
+    
+    return AXDR_SUCCESS;
+}
+
+// 布尔值编码实现
+AXDR_PRIMITIVE int axdr_encode_boolean(AXDR_CODEC* codec, bool value) {
+    if (codec->position + 1 > codec->size) {
+        return AXDR_ERROR_BUFFER_OVERFLOW;
+    }
+    
+    codec->buffer[codec->position++] = value ? 0xFF : 0x00;
+    axdr_checksum_fold(codec);
+    return AXDR_SUCCESS;
+}
+
+// 枚举编码实现
+AXDR_PRIMITIVE int axdr_encode_enum(AXDR_CODEC* codec, int value, int count) {
+    if (value < 0 || value >= count) {
+        return AXDR_ERROR_CONSTRAINT;
+    }
+    
+    return axdr_encode_integer(codec, value, 0, count - 1);
+}
+
+// NULL值编码实现
+AXDR_PRIMITIVE int axdr_encode_null(AXDR_CODEC* codec) {
+    // NULL类型不需要编码任何内容
+    return AXDR_SUCCESS;
+}
+
+// 整数解码实现
+AXDR_PRIMITIVE int axdr_decode_integer(AXDR_CODEC* codec, int32_t* value, int32_t min, int32_t max) {
+    if (codec->position + 4 > codec->size) {
+        return AXDR_ERROR_BUFFER_OVERFLOW;
+    }
+    
+    // 按无符号拼接再转换，避免字节 >= 0x80 左移 24 位时有符号溢出
+    *value = (int32_t)(((uint32_t)codec->buffer[codec->position] << 24) |
+                       ((uint32_t)codec->buffer[codec->position + 1] << 16) |
+                       ((uint32_t)codec->buffer[codec->position + 2] << 8) |
+                       (uint32_t)codec->buffer[codec->position + 3]);
+    codec->position += 4;
+    axdr_checksum_fold(codec);
+    
+    if (*value < min || *value > max) {
+        return AXDR_ERROR_CONSTRAINT;
+    }
+    
+    return AXDR_SUCCESS;
+}
+
+// 无符号整数解码实现
+AXDR_PRIMITIVE int axdr_decode_unsigned(AXDR_CODEC* codec, uint32_t* value, uint32_t max) {
+    if (codec->position + 4 > codec->size) {
+        return AXDR_ERROR_BUFFER_OVERFLOW;
+    }
+    
+    *value = ((uint32_t)codec->buffer[codec->position] << 24) |
+             ((uint32_t)codec->buffer[codec->position + 1] << 16) |
+             ((uint32_t)codec->buffer[codec->position + 2] << 8) |
+             (uint32_t)codec->buffer[codec->position + 3];
+    codec->position += 4;
+    axdr_checksum_fold(codec);
+    
+    if (*value > max) {
+        return AXDR_ERROR_CONSTRAINT;
+    }
+    
+    return AXDR_SUCCESS;
+}
+
+// 布尔值解码实现
+AXDR_PRIMITIVE int axdr_decode_boolean(AXDR_CODEC* codec, bool* value) {
+    if (codec->position + 1 > codec->size) {
+        return AXDR_ERROR_BUFFER_OVERFLOW;
+    }
+    
+    *value = (codec->buffer[codec->position++] != 0);
+    axdr_checksum_fold(codec);
+    return AXDR_SUCCESS;
+}
+
+// 枚举解码实现
+AXDR_PRIMITIVE int axdr_decode_enum(AXDR_CODEC* codec, int* value, int count) {
+    int32_t temp;
+    int result = axdr_decode_integer(codec, &temp, 0, count - 1);
+    if (result == AXDR_SUCCESS) {
+        *value = temp;
+    }
+    return result;
+}
+
+// NULL值解码实现
+AXDR_PRIMITIVE int axdr_decode_null(AXDR_CODEC* codec) {
+    // NULL类型不需要解码任何内容
+    return AXDR_SUCCESS;
+}
+
+// 可变长度整型编码（BER风格，最小字节数）
+AXDR_PRIMITIVE int axdr_encode_varint(AXDR_CODEC* codec, int32_t value) {
+    uint8_t buf[5];
+    int len = 0;
+    uint32_t uval = (uint32_t)value;
+    // ZigZag编码可选，这里直接用无符号
+    do {
+        buf[len] = uval & 0x7F;
+        uval >>= 7;
+        if (uval) buf[len] |= 0x80;
+        len++;
+    } while (uval && len < 5);
+    if (codec->position + len > codec->size) return AXDR_ERROR_BUFFER_OVERFLOW;
+    memcpy(codec->buffer + codec->position, buf, len);
+    codec->position += len;
+    axdr_checksum_fold(codec);
+    return AXDR_SUCCESS;
+}
+
+// 可变长度整型解码
+AXDR_PRIMITIVE int axdr_decode_varint(AXDR_CODEC* codec, int32_t* value) {
+    uint32_t result = 0;
+    int shift = 0;
+    int i = 0;
+    while (i < 5) {
+        if (codec->position >= codec->size) return AXDR_ERROR_BUFFER_OVERFLOW;
+        uint8_t byte = codec->buffer[codec->position++];
+        result |= (uint32_t)(byte & 0x7F) << shift;
+        if (!(byte & 0x80)) break;
+        shift += 7;
+        i++;
+    }
+    axdr_checksum_fold(codec);
+    *value = (int32_t)result;
+    return AXDR_SUCCESS;
+}
+
+#endif // AXDR_INLINE_H
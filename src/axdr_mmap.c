@@ -0,0 +1,233 @@
+#define _GNU_SOURCE
+#include "axdr_mmap.h"
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+// 追加模式下每次扩展的最小字节数
+#define AXDR_MMAP_MIN_GROWTH  (64 * 1024)
+
+static size_t axdr_mmap_page_size(void) {
+    long page = sysconf(_SC_PAGESIZE);
+    return page > 0 ? (size_t)page : 4096;
+}
+
+static int axdr_mmap_file_size(int fd, size_t* size) {
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size < 0) {
+        return AXDR_ERROR_INVALID_VALUE;
+    }
+    *size = (size_t)st.st_size;
+    return AXDR_SUCCESS;
+}
+
+// 只读映射实现
+AXDR_MMAP_CODEC* axdr_mmap_codec_open(const char* path, size_t offset, size_t length) {
+    if (!path) {
+        return NULL;
+    }
+
+    AXDR_MMAP_CODEC* mcodec = (AXDR_MMAP_CODEC*)calloc(1, sizeof(AXDR_MMAP_CODEC));
+    if (!mcodec) {
+        return NULL;
+    }
+
+    mcodec->mode = AXDR_MMAP_READ;
+    mcodec->fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (mcodec->fd < 0 || axdr_mmap_file_size(mcodec->fd, &mcodec->fileSize) != AXDR_SUCCESS) {
+        goto fail;
+    }
+
+    // 截断到文件实际大小，偏移越界时得到一个空区域
+    size_t available = offset < mcodec->fileSize ? mcodec->fileSize - offset : 0;
+    if (length == 0 || length > available) {
+        length = available;
+    }
+
+    size_t page = axdr_mmap_page_size();
+    mcodec->mapOffset = offset - offset % page;
+    mcodec->skew = offset - mcodec->mapOffset;
+
+    if (length > 0) {
+        mcodec->mapLength = mcodec->skew + length;
+        void* map = mmap(NULL, mcodec->mapLength, PROT_READ, MAP_SHARED,
+                         mcodec->fd, (off_t)mcodec->mapOffset);
+        if (map == MAP_FAILED) {
+            goto fail;
+        }
+        mcodec->map = (uint8_t*)map;
+        madvise(mcodec->map, mcodec->mapLength, MADV_SEQUENTIAL);
+    }
+
+    axdr_codec_attach(&mcodec->codec, mcodec->map ? mcodec->map + mcodec->skew : NULL, length);
+    return mcodec;
+
+fail:
+    if (mcodec->fd >= 0) {
+        close(mcodec->fd);
+    }
+    free(mcodec);
+    return NULL;
+}
+
+// 追加映射实现
+AXDR_MMAP_CODEC* axdr_mmap_codec_open_append(const char* path, size_t reserve) {
+    if (!path) {
+        return NULL;
+    }
+
+    AXDR_MMAP_CODEC* mcodec = (AXDR_MMAP_CODEC*)calloc(1, sizeof(AXDR_MMAP_CODEC));
+    if (!mcodec) {
+        return NULL;
+    }
+
+    mcodec->mode = AXDR_MMAP_APPEND;
+    mcodec->fd = open(path, O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    if (mcodec->fd < 0 || axdr_mmap_file_size(mcodec->fd, &mcodec->fileSize) != AXDR_SUCCESS) {
+        goto fail;
+    }
+
+    axdr_codec_attach(&mcodec->codec, NULL, 0);
+    mcodec->codec.position = mcodec->fileSize;
+    if (axdr_mmap_codec_reserve(mcodec, reserve) != AXDR_SUCCESS) {
+        goto fail;
+    }
+    return mcodec;
+
+fail:
+    if (mcodec->map) {
+        munmap(mcodec->map, mcodec->mapLength);
+    }
+    if (mcodec->fd >= 0) {
+        close(mcodec->fd);
+    }
+    free(mcodec);
+    return NULL;
+}
+
+int axdr_mmap_codec_reserve(AXDR_MMAP_CODEC* mcodec, size_t extra) {
+    if (!mcodec || mcodec->mode != AXDR_MMAP_APPEND) {
+        return AXDR_ERROR_INVALID_VALUE;
+    }
+
+    size_t needed = mcodec->codec.position + extra;
+    if (needed <= mcodec->codec.size && mcodec->map) {
+        return AXDR_SUCCESS;
+    }
+
+    // 按倍数增长，减少 ftruncate/mremap 次数
+    size_t page = axdr_mmap_page_size();
+    size_t length = mcodec->mapLength * 2;
+    if (length < needed) {
+        length = needed;
+    }
+    if (length < AXDR_MMAP_MIN_GROWTH) {
+        length = AXDR_MMAP_MIN_GROWTH;
+    }
+    length = (length + page - 1) / page * page;
+
+    if (ftruncate(mcodec->fd, (off_t)length) != 0) {
+        return AXDR_ERROR_BUFFER_OVERFLOW;
+    }
+    mcodec->fileSize = length;
+
+    void* map;
+#ifdef MREMAP_MAYMOVE
+    if (mcodec->map) {
+        map = mremap(mcodec->map, mcodec->mapLength, length, MREMAP_MAYMOVE);
+    } else
+#endif
+    {
+        if (mcodec->map) {
+            munmap(mcodec->map, mcodec->mapLength);
+            mcodec->map = NULL;
+        }
+        map = mmap(NULL, length, PROT_READ | PROT_WRITE, MAP_SHARED, mcodec->fd, 0);
+    }
+    if (map == MAP_FAILED) {
+        return AXDR_ERROR_BUFFER_OVERFLOW;
+    }
+
+    mcodec->map = (uint8_t*)map;
+    mcodec->mapLength = length;
+    mcodec->codec.buffer = mcodec->map;
+    mcodec->codec.size = length;
+    madvise(mcodec->map, mcodec->mapLength, MADV_SEQUENTIAL);
+    return AXDR_SUCCESS;
+}
+
+int axdr_mmap_codec_refresh(AXDR_MMAP_CODEC* mcodec) {
+    if (!mcodec) {
+        return AXDR_ERROR_INVALID_VALUE;
+    }
+
+    size_t fileSize;
+    int result = axdr_mmap_file_size(mcodec->fd, &fileSize);
+    if (result != AXDR_SUCCESS) {
+        return result;
+    }
+    mcodec->fileSize = fileSize;
+
+    // 只收缩不扩展：超出文件末尾的页面访问会触发 SIGBUS
+    size_t start = mcodec->mapOffset + mcodec->skew;
+    size_t available = fileSize > start ? fileSize - start : 0;
+    if (mcodec->codec.size > available) {
+        mcodec->codec.size = available;
+    }
+    if (mcodec->codec.position > mcodec->codec.size) {
+        return AXDR_ERROR_BUFFER_OVERFLOW;
+    }
+    return AXDR_SUCCESS;
+}
+
+int axdr_mmap_codec_advise(AXDR_MMAP_CODEC* mcodec, int advice) {
+    if (!mcodec) {
+        return AXDR_ERROR_INVALID_VALUE;
+    }
+    if (!mcodec->map) {
+        return AXDR_SUCCESS;
+    }
+
+    int native;
+    switch (advice) {
+        case AXDR_MMAP_ADVICE_SEQUENTIAL: native = MADV_SEQUENTIAL; break;
+        case AXDR_MMAP_ADVICE_RANDOM:     native = MADV_RANDOM; break;
+        case AXDR_MMAP_ADVICE_WILLNEED:   native = MADV_WILLNEED; break;
+        case AXDR_MMAP_ADVICE_DONTNEED:   native = MADV_DONTNEED; break;
+        default:
+            return AXDR_ERROR_INVALID_VALUE;
+    }
+
+    return madvise(mcodec->map, mcodec->mapLength, native) == 0 ? AXDR_SUCCESS : AXDR_ERROR_INVALID_VALUE;
+}
+
+int axdr_mmap_codec_sync(AXDR_MMAP_CODEC* mcodec) {
+    if (!mcodec || mcodec->mode != AXDR_MMAP_APPEND) {
+        return AXDR_ERROR_INVALID_VALUE;
+    }
+    if (!mcodec->map || mcodec->codec.position == 0) {
+        return AXDR_SUCCESS;
+    }
+    return msync(mcodec->map, mcodec->codec.position, MS_SYNC) == 0 ? AXDR_SUCCESS : AXDR_ERROR_INVALID_VALUE;
+}
+
+int axdr_mmap_codec_close(AXDR_MMAP_CODEC* mcodec) {
+    if (!mcodec) {
+        return AXDR_ERROR_INVALID_VALUE;
+    }
+
+    int result = AXDR_SUCCESS;
+    if (mcodec->map) {
+        munmap(mcodec->map, mcodec->mapLength);
+    }
+    if (mcodec->mode == AXDR_MMAP_APPEND &&
+        ftruncate(mcodec->fd, (off_t)mcodec->codec.position) != 0) {
+        result = AXDR_ERROR_INVALID_VALUE;
+    }
+    close(mcodec->fd);
+    free(mcodec);
+    return result;
+}
@@ -0,0 +1,62 @@
+#ifndef AXDR_MMAP_H
+#define AXDR_MMAP_H
+
+#include "axdr.h"
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// 映射方式
+#define AXDR_MMAP_READ    0   // 只读映射，用于解码
+#define AXDR_MMAP_APPEND  1   // 读写映射，定位到文件末尾，用于追加编码
+
+// 访问模式提示（对应 madvise）
+#define AXDR_MMAP_ADVICE_SEQUENTIAL  0
+#define AXDR_MMAP_ADVICE_RANDOM      1
+#define AXDR_MMAP_ADVICE_WILLNEED    2
+#define AXDR_MMAP_ADVICE_DONTNEED    3
+
+// 基于内存映射文件的编解码上下文
+// codec 必须是第一个成员，可直接作为 AXDR_CODEC* 传给所有 axdr_encode_*/axdr_decode_*
+typedef struct {
+    AXDR_CODEC codec;       // 编解码上下文，buffer 指向映射区域中的请求位置
+    int        fd;          // 文件描述符
+    int        mode;        // AXDR_MMAP_READ / AXDR_MMAP_APPEND
+    uint8_t*   map;         // 映射起始地址（按页对齐）
+    size_t     mapLength;   // 映射长度
+    size_t     mapOffset;   // 映射在文件中的起始偏移（按页对齐）
+    size_t     skew;        // 请求偏移与页对齐偏移之差
+    size_t     fileSize;    // 当前已知的文件大小
+} AXDR_MMAP_CODEC;
+
+// 只读映射文件中 [offset, offset + length) 区域，length 为 0 表示到文件末尾
+// 区域超出文件实际大小时按实际大小截断
+AXDR_MMAP_CODEC* axdr_mmap_codec_open(const char* path, size_t offset, size_t length);
+
+// 以追加方式映射文件（不存在则创建），codec->position 指向文件末尾，
+// 并预留 reserve 字节的可写空间
+AXDR_MMAP_CODEC* axdr_mmap_codec_open_append(const char* path, size_t reserve);
+
+// 追加模式下扩展可写空间，保证 position 之后至少还有 extra 字节
+// 映射地址可能改变，codec->buffer 随之更新
+int axdr_mmap_codec_reserve(AXDR_MMAP_CODEC* mcodec, size_t extra);
+
+// 重新检查文件大小：文件被截断时收缩 codec->size，避免访问已失效的页面
+int axdr_mmap_codec_refresh(AXDR_MMAP_CODEC* mcodec);
+
+// 设置访问模式提示
+int axdr_mmap_codec_advise(AXDR_MMAP_CODEC* mcodec, int advice);
+
+// 追加模式下把已编码的数据刷到磁盘
+int axdr_mmap_codec_sync(AXDR_MMAP_CODEC* mcodec);
+
+// 关闭映射；追加模式下文件被截断到 codec->position，去掉预留的空白区域
+int axdr_mmap_codec_close(AXDR_MMAP_CODEC* mcodec);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // AXDR_MMAP_H
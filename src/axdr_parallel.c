@@ -0,0 +1,338 @@
+#include "axdr_parallel.h"
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+
+// 一次并行解码任务
+typedef struct {
+    const uint8_t*    buffer;           // 源缓冲区
+    uint8_t*          elements;         // 目标数组
+    size_t            elementSize;
+    AXDR_DECODE_FIELD decoder;
+    size_t            wireSize;         // 定长元素的编码长度，变长为 0
+    size_t            base;             // 第一个元素的偏移（定长）
+    const size_t*     offsets;          // 各元素起始偏移，共 elementCount + 1 项（变长）
+    size_t            elementCount;     // 需要解码的元素个数
+    size_t            chunkElements;    // 每块元素个数
+    size_t            chunkCount;
+    int*              chunkErrors;      // 各块的错误码
+    size_t*           chunkFailed;      // 各块中出错的元素序号
+    atomic_size_t     nextChunk;        // 下一个待领取的块
+    atomic_size_t     firstFailedChunk; // 已知出错的最小块号，之后的块无需解码
+} PARALLEL_JOB;
+
+struct AXDR_DECODE_POOL {
+    pthread_t*      threads;
+    size_t          threadCount;
+    pthread_mutex_t lock;
+    pthread_cond_t  wake;           // 有新任务或需要退出
+    pthread_cond_t  idle;           // 工作线程都已完成当前任务
+    pthread_mutex_t submit;         // 同一时间只执行一个任务
+    PARALLEL_JOB*   job;
+    uint64_t        generation;     // 任务序号
+    size_t          running;        // 仍在执行当前任务的工作线程数
+    int             stop;
+};
+
+// 解码一个块，块内在第一个出错的元素处停止
+static void parallel_run_chunk(PARALLEL_JOB* job, size_t chunk) {
+    size_t first = chunk * job->chunkElements;
+    size_t last = first + job->chunkElements;
+    if (last > job->elementCount) {
+        last = job->elementCount;
+    }
+
+    size_t start;
+    size_t end;
+    if (job->wireSize > 0) {
+        start = job->base + first * job->wireSize;
+        end = job->base + last * job->wireSize;
+    } else {
+        start = job->offsets[first];
+        end = job->offsets[last];
+    }
+
+    AXDR_CODEC window;
+    axdr_codec_attach(&window, (uint8_t*)job->buffer + start, end - start);
+    uint8_t* element = job->elements + first * job->elementSize;
+    int result = AXDR_SUCCESS;
+    size_t index;
+    for (index = first; index < last; index++) {
+        result = job->decoder(&window, element);
+        // 每个元素必须恰好消耗其编码长度（变长元素为预扫描得到的边界），
+        // 出错序号是第一个与边界不一致的元素
+        size_t expected = job->wireSize > 0 ? (index - first + 1) * job->wireSize
+                                            : job->offsets[index + 1] - start;
+        if (result == AXDR_SUCCESS && window.position != expected) {
+            result = AXDR_ERROR_INVALID_LENGTH;
+        }
+        if (result != AXDR_SUCCESS) {
+            break;
+        }
+        element += job->elementSize;
+    }
+
+    job->chunkErrors[chunk] = result;
+    job->chunkFailed[chunk] = index;
+    if (result != AXDR_SUCCESS) {
+        size_t known = atomic_load_explicit(&job->firstFailedChunk, memory_order_relaxed);
+        while (chunk < known &&
+               !atomic_compare_exchange_weak_explicit(&job->firstFailedChunk, &known, chunk,
+                                                      memory_order_relaxed, memory_order_relaxed)) {
+        }
+    }
+}
+
+static void parallel_work(PARALLEL_JOB* job) {
+    for (;;) {
+        size_t chunk = atomic_fetch_add_explicit(&job->nextChunk, 1, memory_order_relaxed);
+        if (chunk >= job->chunkCount) {
+            return;
+        }
+        // 更早的块已经出错，后面的块不影响结果
+        if (chunk > atomic_load_explicit(&job->firstFailedChunk, memory_order_relaxed)) {
+            job->chunkErrors[chunk] = AXDR_SUCCESS;
+            continue;
+        }
+        parallel_run_chunk(job, chunk);
+    }
+}
+
+static void* parallel_worker(void* arg) {
+    AXDR_DECODE_POOL* pool = (AXDR_DECODE_POOL*)arg;
+    uint64_t seen = 0;
+
+    pthread_mutex_lock(&pool->lock);
+    for (;;) {
+        while (!pool->stop && pool->generation == seen) {
+            pthread_cond_wait(&pool->wake, &pool->lock);
+        }
+        if (pool->stop) {
+            break;
+        }
+        seen = pool->generation;
+        PARALLEL_JOB* job = pool->job;
+        pthread_mutex_unlock(&pool->lock);
+
+        parallel_work(job);
+
+        pthread_mutex_lock(&pool->lock);
+        if (--pool->running == 0) {
+            pthread_cond_signal(&pool->idle);
+        }
+    }
+    pthread_mutex_unlock(&pool->lock);
+    return NULL;
+}
+
+// 线程池实现
+AXDR_DECODE_POOL* axdr_decode_pool_create(size_t threads) {
+    AXDR_DECODE_POOL* pool = (AXDR_DECODE_POOL*)calloc(1, sizeof(AXDR_DECODE_POOL));
+    if (!pool) {
+        return NULL;
+    }
+    if (threads > 0) {
+        pool->threads = (pthread_t*)calloc(threads, sizeof(pthread_t));
+        if (!pool->threads) {
+            free(pool);
+            return NULL;
+        }
+    }
+
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_mutex_init(&pool->submit, NULL);
+    pthread_cond_init(&pool->wake, NULL);
+    pthread_cond_init(&pool->idle, NULL);
+
+    for (size_t i = 0; i < threads; i++) {
+        if (pthread_create(&pool->threads[i], NULL, parallel_worker, pool) != 0) {
+            axdr_decode_pool_destroy(pool);
+            return NULL;
+        }
+        pool->threadCount++;
+    }
+    return pool;
+}
+
+void axdr_decode_pool_destroy(AXDR_DECODE_POOL* pool) {
+    if (!pool) {
+        return;
+    }
+
+    pthread_mutex_lock(&pool->lock);
+    pool->stop = 1;
+    pthread_cond_broadcast(&pool->wake);
+    pthread_mutex_unlock(&pool->lock);
+    for (size_t i = 0; i < pool->threadCount; i++) {
+        pthread_join(pool->threads[i], NULL);
+    }
+
+    pthread_cond_destroy(&pool->idle);
+    pthread_cond_destroy(&pool->wake);
+    pthread_mutex_destroy(&pool->submit);
+    pthread_mutex_destroy(&pool->lock);
+    free(pool->threads);
+    free(pool);
+}
+
+// 在线程池上执行任务，调用线程也参与
+static void parallel_execute(AXDR_DECODE_POOL* pool, PARALLEL_JOB* job) {
+    if (!pool || pool->threadCount == 0 || job->chunkCount <= 1) {
+        parallel_work(job);
+        return;
+    }
+
+    pthread_mutex_lock(&pool->submit);
+    pthread_mutex_lock(&pool->lock);
+    pool->job = job;
+    pool->running = pool->threadCount;
+    pool->generation++;
+    pthread_cond_broadcast(&pool->wake);
+    pthread_mutex_unlock(&pool->lock);
+
+    parallel_work(job);
+
+    pthread_mutex_lock(&pool->lock);
+    while (pool->running > 0) {
+        pthread_cond_wait(&pool->idle, &pool->lock);
+    }
+    pool->job = NULL;
+    pthread_mutex_unlock(&pool->lock);
+    pthread_mutex_unlock(&pool->submit);
+}
+
+// 并行解码实现
+int axdr_decode_sequence_of_parallel(AXDR_DECODE_POOL* pool, AXDR_CODEC* codec,
+                                     AXDR_SEQUENCE_OF* sequence, AXDR_DECODE_FIELD elementDecoder,
+                                     size_t elementWireSize, AXDR_SKIP_FIELD skipper,
+                                     size_t* failedIndex) {
+    if (failedIndex) {
+        *failedIndex = AXDR_PARALLEL_NO_INDEX;
+    }
+    if (!codec || !sequence || !elementDecoder || !sequence->elements ||
+        (elementWireSize == 0 && !skipper)) {
+        return AXDR_ERROR_INVALID_VALUE;
+    }
+
+    // 解码元素个数
+    size_t start = codec->position;
+    uint32_t count;
+    uint32_t maxCount = sequence->maxCount > UINT32_MAX ? UINT32_MAX : (uint32_t)sequence->maxCount;
+    int result = axdr_decode_unsigned(codec, &count, maxCount);
+    if (result == AXDR_SUCCESS) {
+        // 预算在调用线程一次性计入元素个数；各分块的窗口不带预算
+        result = axdr_budget_elements(codec, count);
+    }
+    if (result != AXDR_SUCCESS) {
+        codec->position = start;
+        return result;
+    }
+
+    size_t workers = pool ? pool->threadCount + 1 : 1;
+    size_t chunkElements = (count + workers * 4 - 1) / (workers * 4);
+    if (chunkElements < AXDR_PARALLEL_MIN_CHUNK) {
+        chunkElements = AXDR_PARALLEL_MIN_CHUNK;
+    }
+
+    PARALLEL_JOB job;
+    memset(&job, 0, sizeof(job));
+    job.buffer = codec->buffer;
+    job.elements = (uint8_t*)sequence->elements;
+    job.elementSize = sequence->elementSize;
+    job.decoder = elementDecoder;
+    job.wireSize = elementWireSize;
+    job.base = codec->position;
+    job.chunkElements = chunkElements;
+
+    // 边界确定前就能发现的错误（数据截断、预扫描失败），其序号之前的元素仍需解码
+    int boundaryError = AXDR_SUCCESS;
+    size_t boundaryIndex = count;
+    size_t* offsets = NULL;
+    size_t end;
+    size_t remaining = codec->size - codec->position;
+
+    if (elementWireSize > 0) {
+        if ((uint64_t)count * elementWireSize > remaining) {
+            boundaryError = AXDR_ERROR_BUFFER_OVERFLOW;
+            boundaryIndex = remaining / elementWireSize;
+        }
+        end = codec->position + (size_t)count * elementWireSize;
+    } else {
+        // 变长元素：预扫描出每个元素的起始偏移，分块与逐元素核对长度都用它。
+        // 每个元素至少 1 字节，能扫描到的元素不超过剩余字节数
+        size_t capacity = count < remaining ? count : remaining;
+        offsets = (size_t*)malloc((capacity + 1) * sizeof(size_t));
+        if (!offsets) {
+            codec->position = start;
+            return AXDR_ERROR_BUFFER_OVERFLOW;
+        }
+        AXDR_CODEC scan = *codec;
+        scan.checksumType = 0;
+        for (size_t i = 0; i < count; i++) {
+            offsets[i] = scan.position;
+            size_t before = scan.position;
+            result = skipper(&scan);
+            if (result == AXDR_SUCCESS && scan.position == before) {
+                result = AXDR_ERROR_INVALID_LENGTH;
+            }
+            if (result != AXDR_SUCCESS) {
+                // 出错元素之前的部分仍按块解码
+                boundaryError = result;
+                boundaryIndex = i;
+                scan.position = before;
+                break;
+            }
+        }
+        end = scan.position;
+        size_t scanned = boundaryError == AXDR_SUCCESS ? count : boundaryIndex;
+        offsets[scanned] = end;
+        job.offsets = offsets;
+    }
+
+    job.elementCount = boundaryError == AXDR_SUCCESS ? count : boundaryIndex;
+    job.chunkCount = (job.elementCount + chunkElements - 1) / chunkElements;
+    atomic_init(&job.nextChunk, 0);
+    atomic_init(&job.firstFailedChunk, SIZE_MAX);
+
+    if (job.chunkCount > 0) {
+        job.chunkErrors = (int*)calloc(job.chunkCount, sizeof(int));
+        job.chunkFailed = (size_t*)calloc(job.chunkCount, sizeof(size_t));
+        if (!job.chunkErrors || !job.chunkFailed) {
+            free(job.chunkErrors);
+            free(job.chunkFailed);
+            free(offsets);
+            codec->position = start;
+            return AXDR_ERROR_BUFFER_OVERFLOW;
+        }
+        parallel_execute(pool, &job);
+    }
+
+    // 取序号最小的错误
+    result = boundaryError;
+    size_t failed = boundaryIndex;
+    for (size_t c = 0; c < job.chunkCount; c++) {
+        if (job.chunkErrors[c] != AXDR_SUCCESS) {
+            result = job.chunkErrors[c];
+            failed = job.chunkFailed[c];
+            break;
+        }
+    }
+
+    free(job.chunkErrors);
+    free(job.chunkFailed);
+    free(offsets);
+
+    if (result != AXDR_SUCCESS) {
+        if (failedIndex) {
+            *failedIndex = failed;
+        }
+        codec->position = start;
+        return result;
+    }
+
+    sequence->count = count;
+    codec->position = end;
+    axdr_checksum_fold(codec);
+    return AXDR_SUCCESS;
+}
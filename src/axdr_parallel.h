@@ -0,0 +1,43 @@
+#ifndef AXDR_PARALLEL_H
+#define AXDR_PARALLEL_H
+
+#include "axdr.h"
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// 大型 SEQUENCE OF 的并行解码
+//
+// 元素按连续的块划分：定长元素直接按 元素序号 × 编码长度 计算块边界；
+// 变长元素先用跳过函数串行预扫描出块边界。各块在线程池上解码，直接写入
+// sequence->elements 中对应的位置。出错时返回序号最小的出错元素及其错误码，
+// 结果与串行解码一致，不受线程调度影响。
+
+#define AXDR_PARALLEL_MIN_CHUNK  1024      // 每块最少元素个数，元素较少时在调用线程中解码
+#define AXDR_PARALLEL_NO_INDEX   SIZE_MAX  // 错误不属于某个元素（如元素个数本身非法）
+
+// 跳过一个元素的编码（只前移 position，不写入任何结构）
+typedef int (*AXDR_SKIP_FIELD)(AXDR_CODEC* codec);
+
+typedef struct AXDR_DECODE_POOL AXDR_DECODE_POOL;
+
+// 创建含 threads 个工作线程的线程池（调用线程也参与解码），threads 为 0 时只在调用线程解码
+AXDR_DECODE_POOL* axdr_decode_pool_create(size_t threads);
+void axdr_decode_pool_destroy(AXDR_DECODE_POOL* pool);
+
+// 并行解码 SEQUENCE OF
+//   elementWireSize > 0：元素编码定长，skipper 可为 NULL
+//   elementWireSize == 0：元素编码变长，必须提供 skipper，每个元素至少占 1 字节
+// 成功后 codec->position 指向序列之后；失败时 position 不变，*failedIndex 为最小的出错元素序号
+int axdr_decode_sequence_of_parallel(AXDR_DECODE_POOL* pool, AXDR_CODEC* codec,
+                                     AXDR_SEQUENCE_OF* sequence, AXDR_DECODE_FIELD elementDecoder,
+                                     size_t elementWireSize, AXDR_SKIP_FIELD skipper,
+                                     size_t* failedIndex);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // AXDR_PARALLEL_H
@@ -0,0 +1,247 @@
+#define _GNU_SOURCE
+#include "axdr_ring.h"
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define ring_pause() _mm_pause()
+#else
+#define ring_pause() ((void)0)
+#endif
+
+static void ring_notify(AXDR_RING_SIGNAL* signal) {
+    atomic_fetch_add_explicit(&signal->sequence, 1, memory_order_seq_cst);
+    if (atomic_load_explicit(&signal->waiters, memory_order_seq_cst) > 0) {
+        syscall(SYS_futex, &signal->sequence, FUTEX_WAKE_PRIVATE, INT32_MAX, NULL, NULL, 0);
+    }
+}
+
+static int64_t ring_now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+// 在 signal 上睡眠直到序号变化或超时；sequence 为检查条件前读到的序号
+static void ring_sleep(AXDR_RING_SIGNAL* signal, unsigned sequence, int64_t deadline) {
+    struct timespec ts;
+    struct timespec* timeout = NULL;
+    if (deadline >= 0) {
+        int64_t left = deadline - ring_now_ms();
+        if (left <= 0) {
+            return;
+        }
+        ts.tv_sec = left / 1000;
+        ts.tv_nsec = (left % 1000) * 1000000;
+        timeout = &ts;
+    }
+    syscall(SYS_futex, &signal->sequence, FUTEX_WAIT_PRIVATE, sequence, timeout, NULL, 0);
+}
+
+AXDR_RING* axdr_ring_create(size_t capacity, size_t elementSize, int mode) {
+    if (capacity == 0 || elementSize == 0 || (mode != AXDR_RING_SPSC && mode != AXDR_RING_MPMC)) {
+        return NULL;
+    }
+
+    size_t size = 1;
+    while (size < capacity) {
+        size <<= 1;
+    }
+
+    AXDR_RING* ring = (AXDR_RING*)aligned_alloc(AXDR_CACHE_LINE, sizeof(AXDR_RING));
+    if (!ring) {
+        return NULL;
+    }
+    memset(ring, 0, sizeof(AXDR_RING));
+
+    ring->capacity = size;
+    ring->mask = size - 1;
+    ring->elementSize = elementSize;
+    ring->slotStride = (elementSize + AXDR_CACHE_LINE - 1) / AXDR_CACHE_LINE * AXDR_CACHE_LINE;
+    ring->mode = mode;
+    ring->slots = (uint8_t*)aligned_alloc(AXDR_CACHE_LINE, ring->slotStride * size);
+    if (!ring->slots) {
+        free(ring);
+        return NULL;
+    }
+
+    atomic_init(&ring->prodHead, 0);
+    atomic_init(&ring->prodTail, 0);
+    atomic_init(&ring->consHead, 0);
+    atomic_init(&ring->consTail, 0);
+    atomic_init(&ring->notEmpty.sequence, 0);
+    atomic_init(&ring->notEmpty.waiters, 0);
+    atomic_init(&ring->notFull.sequence, 0);
+    atomic_init(&ring->notFull.waiters, 0);
+    return ring;
+}
+
+void axdr_ring_destroy(AXDR_RING* ring) {
+    if (ring) {
+        free(ring->slots);
+        free(ring);
+    }
+}
+
+static void ring_copy_in(AXDR_RING* ring, size_t position, const uint8_t* src, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        memcpy(ring->slots + ((position + i) & ring->mask) * ring->slotStride,
+               src + i * ring->elementSize, ring->elementSize);
+    }
+}
+
+static void ring_copy_out(const AXDR_RING* ring, size_t position, uint8_t* dst, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        memcpy(dst + i * ring->elementSize,
+               ring->slots + ((position + i) & ring->mask) * ring->slotStride, ring->elementSize);
+    }
+}
+
+size_t axdr_ring_enqueue(AXDR_RING* ring, const void* elements, size_t count) {
+    if (!ring || !elements || count == 0) {
+        return 0;
+    }
+
+    size_t head;
+    if (ring->mode == AXDR_RING_SPSC) {
+        head = atomic_load_explicit(&ring->prodHead, memory_order_relaxed);
+        size_t space = ring->capacity - (head - atomic_load_explicit(&ring->consTail, memory_order_acquire));
+        if (count > space) {
+            count = space;
+        }
+        if (count == 0) {
+            return 0;
+        }
+        atomic_store_explicit(&ring->prodHead, head + count, memory_order_relaxed);
+    } else {
+        // 多生产者：CAS 占用一段连续位置
+        head = atomic_load_explicit(&ring->prodHead, memory_order_relaxed);
+        size_t n;
+        do {
+            size_t space = ring->capacity - (head - atomic_load_explicit(&ring->consTail, memory_order_acquire));
+            n = count < space ? count : space;
+            if (n == 0) {
+                return 0;
+            }
+        } while (!atomic_compare_exchange_weak_explicit(&ring->prodHead, &head, head + n,
+                                                        memory_order_relaxed, memory_order_relaxed));
+        count = n;
+    }
+
+    ring_copy_in(ring, head, (const uint8_t*)elements, count);
+
+    // 按占用顺序发布：等待先占位的生产者发布完成。acquire 使其写入的槽位先行于
+    // 本次 release，取得较后 prodTail 的消费者也能看到前面所有生产者的写入
+    if (ring->mode == AXDR_RING_MPMC) {
+        while (atomic_load_explicit(&ring->prodTail, memory_order_acquire) != head) {
+            ring_pause();
+        }
+    }
+    atomic_store_explicit(&ring->prodTail, head + count, memory_order_release);
+    ring_notify(&ring->notEmpty);
+    return count;
+}
+
+size_t axdr_ring_dequeue(AXDR_RING* ring, void* elements, size_t maxCount) {
+    if (!ring || !elements || maxCount == 0) {
+        return 0;
+    }
+
+    size_t head;
+    size_t count;
+    if (ring->mode == AXDR_RING_SPSC) {
+        head = atomic_load_explicit(&ring->consHead, memory_order_relaxed);
+        size_t available = atomic_load_explicit(&ring->prodTail, memory_order_acquire) - head;
+        count = maxCount < available ? maxCount : available;
+        if (count == 0) {
+            return 0;
+        }
+        atomic_store_explicit(&ring->consHead, head + count, memory_order_relaxed);
+    } else {
+        head = atomic_load_explicit(&ring->consHead, memory_order_relaxed);
+        do {
+            size_t available = atomic_load_explicit(&ring->prodTail, memory_order_acquire) - head;
+            count = maxCount < available ? maxCount : available;
+            if (count == 0) {
+                return 0;
+            }
+        } while (!atomic_compare_exchange_weak_explicit(&ring->consHead, &head, head + count,
+                                                        memory_order_relaxed, memory_order_relaxed));
+    }
+
+    ring_copy_out(ring, head, (uint8_t*)elements, count);
+
+    // 同上：acquire 把先占位的消费者对槽位的读取传递给之后复用槽位的生产者
+    if (ring->mode == AXDR_RING_MPMC) {
+        while (atomic_load_explicit(&ring->consTail, memory_order_acquire) != head) {
+            ring_pause();
+        }
+    }
+    atomic_store_explicit(&ring->consTail, head + count, memory_order_release);
+    ring_notify(&ring->notFull);
+    return count;
+}
+
+size_t axdr_ring_enqueue_wait(AXDR_RING* ring, const void* elements, size_t count,
+                              unsigned spins, int timeoutMs) {
+    int64_t deadline = timeoutMs >= 0 ? ring_now_ms() + timeoutMs : -1;
+    for (;;) {
+        unsigned sequence = atomic_load_explicit(&ring->notFull.sequence, memory_order_acquire);
+        size_t n = axdr_ring_enqueue(ring, elements, count);
+        if (n > 0) {
+            return n;
+        }
+        if (spins > 0) {
+            spins--;
+            ring_pause();
+            continue;
+        }
+        if (deadline >= 0 && ring_now_ms() >= deadline) {
+            return 0;
+        }
+        atomic_fetch_add(&ring->notFull.waiters, 1);
+        if (atomic_load(&ring->notFull.sequence) == sequence) {
+            ring_sleep(&ring->notFull, sequence, deadline);
+        }
+        atomic_fetch_sub(&ring->notFull.waiters, 1);
+    }
+}
+
+size_t axdr_ring_dequeue_wait(AXDR_RING* ring, void* elements, size_t maxCount,
+                              unsigned spins, int timeoutMs) {
+    int64_t deadline = timeoutMs >= 0 ? ring_now_ms() + timeoutMs : -1;
+    for (;;) {
+        unsigned sequence = atomic_load_explicit(&ring->notEmpty.sequence, memory_order_acquire);
+        size_t n = axdr_ring_dequeue(ring, elements, maxCount);
+        if (n > 0) {
+            return n;
+        }
+        if (spins > 0) {
+            spins--;
+            ring_pause();
+            continue;
+        }
+        if (deadline >= 0 && ring_now_ms() >= deadline) {
+            return 0;
+        }
+        atomic_fetch_add(&ring->notEmpty.waiters, 1);
+        if (atomic_load(&ring->notEmpty.sequence) == sequence) {
+            ring_sleep(&ring->notEmpty, sequence, deadline);
+        }
+        atomic_fetch_sub(&ring->notEmpty.waiters, 1);
+    }
+}
+
+size_t axdr_ring_count(const AXDR_RING* ring) {
+    if (!ring) {
+        return 0;
+    }
+    size_t tail = atomic_load_explicit((atomic_size_t*)&ring->prodTail, memory_order_acquire);
+    size_t head = atomic_load_explicit((atomic_size_t*)&ring->consTail, memory_order_acquire);
+    return tail - head;
+}
@@ -0,0 +1,59 @@
+#ifndef AXDR_RING_H
+#define AXDR_RING_H
+
+#include <stdatomic.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// 解码线程与消费线程之间的无锁环形队列
+//
+// 每个槽位保存一个定长元素（解码后的消息结构体，或指向帧的 AXDR_CODEC 视图），
+// 槽位按缓存行对齐填充，避免相邻槽位的伪共享。
+// 生产/消费位置采用 head/tail 两段式：先占位、拷贝、再按顺序发布，天然支持批量操作。
+
+#define AXDR_CACHE_LINE  64
+
+// 队列模式
+#define AXDR_RING_SPSC  0   // 单生产者单消费者
+#define AXDR_RING_MPMC  1   // 多生产者多消费者（有界）
+
+// 等待通知：先自旋，再通过 futex 睡眠
+typedef struct {
+    atomic_uint sequence;   // 每次发布递增，作为 futex 等待字
+    atomic_uint waiters;    // 正在睡眠的线程数，为0时发布方不做系统调用
+} AXDR_RING_SIGNAL;
+
+typedef struct {
+    _Alignas(AXDR_CACHE_LINE) atomic_size_t prodHead;   // 生产者已占用的位置
+    atomic_size_t prodTail;                             // 生产者已发布的位置
+    _Alignas(AXDR_CACHE_LINE) atomic_size_t consHead;   // 消费者已占用的位置
+    atomic_size_t consTail;                             // 消费者已释放的位置
+    _Alignas(AXDR_CACHE_LINE) AXDR_RING_SIGNAL notEmpty;
+    _Alignas(AXDR_CACHE_LINE) AXDR_RING_SIGNAL notFull;
+    _Alignas(AXDR_CACHE_LINE) uint8_t* slots;
+    size_t capacity;        // 槽位个数（2的幂）
+    size_t mask;
+    size_t elementSize;     // 元素大小
+    size_t slotStride;      // 槽位步长，按缓存行向上取整
+    int    mode;            // AXDR_RING_SPSC / AXDR_RING_MPMC
+} AXDR_RING;
+
+// capacity 向上取整到2的幂
+AXDR_RING* axdr_ring_create(size_t capacity, size_t elementSize, int mode);
+void axdr_ring_destroy(AXDR_RING* ring);
+
+// 批量入队/出队，返回实际处理的元素个数（队列满/空时可能少于请求个数）
+size_t axdr_ring_enqueue(AXDR_RING* ring, const void* elements, size_t count);
+size_t axdr_ring_dequeue(AXDR_RING* ring, void* elements, size_t maxCount);
+
+// 阻塞版本：至少处理一个元素才返回；先自旋 spins 次，再用 futex 睡眠
+// timeoutMs < 0 表示一直等待，超时返回0
+size_t axdr_ring_enqueue_wait(AXDR_RING* ring, const void* elements, size_t count,
+                              unsigned spins, int timeoutMs);
+size_t axdr_ring_dequeue_wait(AXDR_RING* ring, void* elements, size_t maxCount,
+                              unsigned spins, int timeoutMs);
+
+// 当前元素个数（并发时为近似值）
+size_t axdr_ring_count(const AXDR_RING* ring);
+
+#endif // AXDR_RING_H
@@ -0,0 +1,166 @@
+#include "axdr_scaled.h"
+
+#if defined(__x86_64__) && defined(__GNUC__)
+#define AXDR_SCALED_X86 1
+#include <immintrin.h>
+#endif
+
+// 换算表的周期：列数与向量宽度 4 的最小公倍数，使每个向量对应表中连续的 4 项
+#define SCALED_PERIOD_MAX  (AXDR_SCALED_MAX_COLUMNS * 4)
+
+typedef struct {
+    double multiply[SCALED_PERIOD_MAX];     // scaler >= 0 时为 10^scaler，否则为 1
+    double divide[SCALED_PERIOD_MAX];       // scaler < 0 时为 10^-scaler，否则为 1
+    double bias[SCALED_PERIOD_MAX];         // UNSIGNED 列为 2^32：按有符号转换后负值加回
+    size_t period;
+} SCALED_TABLE;
+
+static double scaled_power10(int exponent) {
+    double power = 1.0;
+    for (int i = 0; i < exponent; i++) {
+        power *= 10.0;
+    }
+    return power;
+}
+
+static int scaled_table_init(SCALED_TABLE* table, const AXDR_SCALED_COLUMN* columns, size_t columnCount) {
+    if (!columns || columnCount == 0 || columnCount > AXDR_SCALED_MAX_COLUMNS) {
+        return AXDR_ERROR_INVALID_VALUE;
+    }
+    size_t period = columnCount % 4 == 0 ? columnCount : columnCount % 2 == 0 ? columnCount * 2 : columnCount * 4;
+    for (size_t i = 0; i < period; i++) {
+        const AXDR_SCALED_COLUMN* column = &columns[i % columnCount];
+        double power = scaled_power10(column->scaler < 0 ? -column->scaler : column->scaler);
+        table->multiply[i] = column->scaler >= 0 ? power : 1.0;
+        table->divide[i] = column->scaler < 0 ? power : 1.0;
+        table->bias[i] = column->isUnsigned ? 4294967296.0 : 0.0;
+    }
+    table->period = period;
+    return AXDR_SUCCESS;
+}
+
+static inline double scaled_convert_one(const uint8_t* src, const SCALED_TABLE* table, size_t t) {
+    int32_t raw = (int32_t)(((uint32_t)src[0] << 24) | ((uint32_t)src[1] << 16) |
+                            ((uint32_t)src[2] << 8) | (uint32_t)src[3]);
+    double x = (double)raw;
+    if (raw < 0) {
+        x += table->bias[t];
+    }
+    return x * table->multiply[t] / table->divide[t];
+}
+
+#ifdef AXDR_SCALED_X86
+// AVX2：每次 4 个值，字节重排转为主机序、转 double、补偿 UNSIGNED、乘除，返回已处理的个数
+__attribute__((target("avx2")))
+static size_t scaled_convert_avx2(const uint8_t* src, size_t count, double* dst, const SCALED_TABLE* table) {
+    const __m128i swap = _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+    const __m256d zero = _mm256_setzero_pd();
+    size_t i = 0;
+    size_t t = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128i raw = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(src + i * 4)), swap);
+        __m256d x = _mm256_cvtepi32_pd(raw);
+        __m256d negative = _mm256_cmp_pd(x, zero, _CMP_LT_OQ);
+        x = _mm256_add_pd(x, _mm256_and_pd(negative, _mm256_loadu_pd(table->bias + t)));
+        x = _mm256_mul_pd(x, _mm256_loadu_pd(table->multiply + t));
+        x = _mm256_div_pd(x, _mm256_loadu_pd(table->divide + t));
+        _mm256_storeu_pd(dst + i, x);
+        t += 4;
+        if (t == table->period) {
+            t = 0;
+        }
+    }
+    return i;
+}
+#endif
+
+// 把 count 个高字节在前的 32 位整数换算到 dst，第 i 个值属于第 i % 列数 列
+static void scaled_convert(const uint8_t* src, size_t count, double* dst, const SCALED_TABLE* table) {
+    size_t i = 0;
+#ifdef AXDR_SCALED_X86
+    if (__builtin_cpu_supports("avx2")) {
+        i = scaled_convert_avx2(src, count, dst, table);
+    }
+#endif
+    for (; i < count; i++) {
+        dst[i] = scaled_convert_one(src + i * 4, table, i % table->period);
+    }
+}
+
+int axdr_decode_scaled(AXDR_CODEC* codec, double* values, size_t* rows, size_t maxRows,
+                       const AXDR_SCALED_COLUMN* columns, size_t columnCount) {
+    SCALED_TABLE table;
+    if (!codec || (!values && maxRows > 0) || !rows ||
+        scaled_table_init(&table, columns, columnCount) != AXDR_SUCCESS) {
+        return AXDR_ERROR_INVALID_VALUE;
+    }
+
+    size_t start = codec->position;
+    uint32_t count;
+    int result = axdr_decode_unsigned(codec, &count, maxRows > UINT32_MAX ? UINT32_MAX : (uint32_t)maxRows);
+    if (result != AXDR_SUCCESS) {
+        codec->position = start;
+        return result;
+    }
+    if (count > (codec->size - codec->position) / (columnCount * 4)) {
+        codec->position = start;
+        return AXDR_ERROR_BUFFER_OVERFLOW;
+    }
+    result = axdr_budget_elements(codec, count);
+    if (result != AXDR_SUCCESS) {
+        codec->position = start;
+        return result;
+    }
+
+    size_t total = (size_t)count * columnCount;
+    scaled_convert(codec->buffer + codec->position, total, values, &table);
+    codec->position += total * 4;
+    axdr_checksum_fold(codec);
+    *rows = count;
+    return AXDR_SUCCESS;
+}
+
+int axdr_encode_scaled(AXDR_CODEC* codec, const double* values, size_t rows,
+                       const AXDR_SCALED_COLUMN* columns, size_t columnCount) {
+    SCALED_TABLE table;
+    if (!codec || (!values && rows > 0) || scaled_table_init(&table, columns, columnCount) != AXDR_SUCCESS) {
+        return AXDR_ERROR_INVALID_VALUE;
+    }
+    if (rows > UINT32_MAX) {
+        return AXDR_ERROR_CONSTRAINT;
+    }
+    if (codec->position + 4 > codec->size || rows > (codec->size - codec->position - 4) / (columnCount * 4)) {
+        return AXDR_ERROR_BUFFER_OVERFLOW;
+    }
+
+    size_t start = codec->position;
+    axdr_encode_unsigned(codec, (uint32_t)rows, UINT32_MAX);
+    size_t total = rows * columnCount;
+    for (size_t i = 0; i < total; i++) {
+        size_t t = i % columnCount;
+        double x = values[i] * table.divide[t] / table.multiply[t];
+        if (x != x || x - x != 0) {
+            codec->position = start;
+            return AXDR_ERROR_INVALID_VALUE;
+        }
+        // 四舍五入（远离 0），先做范围检查再转换
+        double low = columns[t].isUnsigned ? -0.5 : -2147483648.5;
+        double high = columns[t].isUnsigned ? 4294967295.5 : 2147483647.5;
+        if (!(x > low && x < high)) {
+            codec->position = start;
+            return AXDR_ERROR_CONSTRAINT;
+        }
+        int64_t whole = (int64_t)x;
+        double fraction = x - (double)whole;
+        whole += fraction >= 0.5 ? 1 : fraction <= -0.5 ? -1 : 0;
+        uint32_t raw = (uint32_t)whole;
+        uint8_t* dst = codec->buffer + codec->position;
+        dst[0] = (uint8_t)(raw >> 24);
+        dst[1] = (uint8_t)(raw >> 16);
+        dst[2] = (uint8_t)(raw >> 8);
+        dst[3] = (uint8_t)raw;
+        codec->position += 4;
+    }
+    axdr_checksum_fold(codec);
+    return AXDR_SUCCESS;
+}
@@ -0,0 +1,45 @@
+#ifndef AXDR_SCALED_H
+#define AXDR_SCALED_H
+
+#include "axdr.h"
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// 带 scaler 的寄存器值批量解码
+//
+// 计量寄存器以整数传输，另有按列给出的 scaler（10 的幂）。这里在解码整数数组的同一遍中
+// 完成字节序转换、转为 double 与乘以 10^scaler，输出即可直接分析，不再需要第二遍换算。
+//
+// 线上格式：SEQUENCE OF 行，每行为 columnCount 个 INTEGER / UNSIGNED 组成的 SEQUENCE，
+// 即 4 字节行数 + 行数 × columnCount × 4 字节；单列数组即 columnCount 为 1。
+// 输出按行存放：values[row * columnCount + column]。
+//
+// scaler 为负时除以 10^-scaler 而不是乘以其倒数，|scaler| <= 22 时 10 的幂可精确表示，
+// 结果与把 "整数e scaler" 按十进制解析的值相同（如 1234、-3 得到 1.234）。
+// 单位不参与换算，由调用者与列一起保存；单位间为 10 的幂的换算（如 Wh 到 kWh）并入 scaler。
+// x86-64 上运行时检测到 AVX2 时每次换算 4 个值，否则逐个换算，两者结果逐位相同。
+
+#define AXDR_SCALED_MAX_COLUMNS  32
+
+typedef struct {
+    int8_t scaler;          // 值 = 原始整数 × 10^scaler
+    bool   isUnsigned;      // 原始整数按 UNSIGNED 解释
+} AXDR_SCALED_COLUMN;
+
+// 解码：values 至少 maxRows × columnCount 个元素，行数写入 rows
+int axdr_decode_scaled(AXDR_CODEC* codec, double* values, size_t* rows, size_t maxRows,
+                       const AXDR_SCALED_COLUMN* columns, size_t columnCount);
+
+// 编码：按列除以 10^scaler 后四舍五入为整数，超出 INTEGER / UNSIGNED 范围时返回
+// AXDR_ERROR_CONSTRAINT，非有限值返回 AXDR_ERROR_INVALID_VALUE，失败时 position 不变
+int axdr_encode_scaled(AXDR_CODEC* codec, const double* values, size_t rows,
+                       const AXDR_SCALED_COLUMN* columns, size_t columnCount);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // AXDR_SCALED_H
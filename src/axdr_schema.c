@@ -0,0 +1,254 @@
+#include "axdr_schema.h"
+#include <ctype.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define SCHEMA_MAX_DEPTH  32
+
+typedef struct {
+    const char* text;
+    size_t      pos;
+    int         failed;
+} SCHEMA_PARSER;
+
+static void schema_free_node(AXDR_SCHEMA* node);
+
+static void schema_skip_space(SCHEMA_PARSER* p) {
+    while (isspace((unsigned char)p->text[p->pos])) {
+        p->pos++;
+    }
+}
+
+static int schema_accept(SCHEMA_PARSER* p, char c) {
+    schema_skip_space(p);
+    if (p->text[p->pos] == c) {
+        p->pos++;
+        return 1;
+    }
+    return 0;
+}
+
+static int schema_expect(SCHEMA_PARSER* p, char c) {
+    if (!schema_accept(p, c)) {
+        p->failed = 1;
+        return 0;
+    }
+    return 1;
+}
+
+// 读取标识符，返回长度，不存在返回 0
+static size_t schema_identifier(SCHEMA_PARSER* p, const char** start) {
+    schema_skip_space(p);
+    *start = p->text + p->pos;
+    size_t length = 0;
+    while (isalnum((unsigned char)(*start)[length]) || (*start)[length] == '_' ||
+           (*start)[length] == '.' || (*start)[length] == '-') {
+        length++;
+    }
+    p->pos += length;
+    return length;
+}
+
+// 读取 [low, high] 范围内的整数，超出范围（含 strtoll 溢出）时解析失败
+static int64_t schema_number(SCHEMA_PARSER* p, int64_t low, int64_t high) {
+    schema_skip_space(p);
+    char* end;
+    long long value = strtoll(p->text + p->pos, &end, 10);
+    if (end == p->text + p->pos || value < low || value > high) {
+        p->failed = 1;
+        return 0;
+    }
+    p->pos = (size_t)(end - p->text);
+    return value;
+}
+
+// 可选的 '(' number ')'
+static int schema_optional_bound(SCHEMA_PARSER* p, int64_t* value, int64_t low, int64_t high) {
+    if (!schema_accept(p, '(')) {
+        return 0;
+    }
+    *value = schema_number(p, low, high);
+    schema_expect(p, ')');
+    return 1;
+}
+
+typedef struct {
+    const char* keyword;
+    int         type;
+} SCHEMA_KEYWORD;
+
+static const SCHEMA_KEYWORD schema_keywords[] = {
+    {"int",       AXDR_TYPE_INTEGER},
+    {"uint",      AXDR_TYPE_UNSIGNED},
+    {"bool",      AXDR_TYPE_BOOLEAN},
+    {"enum",      AXDR_TYPE_ENUM},
+    {"bits",      AXDR_TYPE_BIT_STRING},
+    {"octets",    AXDR_TYPE_OCTET_STRING},
+    {"string",    AXDR_TYPE_VISIBLE_STRING},
+    {"time",      AXDR_TYPE_GENERALIZED_TIME},
+    {"datetime",  AXDR_TYPE_DATE_TIME},
+    {"float32",   AXDR_TYPE_FLOAT32},
+    {"float64",   AXDR_TYPE_FLOAT64},
+    {"null",      AXDR_TYPE_NULL},
+    {"varint",    AXDR_TYPE_VARINT},
+    {"varoctets", AXDR_TYPE_VAROCTET_STRING},
+    {"varstring", AXDR_TYPE_VARVISIBLE_STRING},
+    {"varbits",   AXDR_TYPE_VARBIT_STRING},
+};
+
+static void schema_parse_field(SCHEMA_PARSER* p, AXDR_SCHEMA* node, int depth);
+
+static void schema_parse_type(SCHEMA_PARSER* p, AXDR_SCHEMA* node, int depth) {
+    if (depth > SCHEMA_MAX_DEPTH) {
+        p->failed = 1;
+        return;
+    }
+
+    // SEQUENCE
+    if (schema_accept(p, '{')) {
+        node->type = AXDR_TYPE_SEQUENCE;
+        AXDR_SCHEMA* children = NULL;
+        size_t count = 0;
+        do {
+            AXDR_SCHEMA* grown = (AXDR_SCHEMA*)realloc(children, (count + 1) * sizeof(AXDR_SCHEMA));
+            if (!grown) {
+                p->failed = 1;
+                break;
+            }
+            children = grown;
+            memset(&children[count], 0, sizeof(AXDR_SCHEMA));
+            schema_parse_field(p, &children[count], depth + 1);
+            count++;
+        } while (!p->failed && schema_accept(p, ','));
+        node->children = children;
+        node->childCount = count;
+        schema_expect(p, '}');
+        return;
+    }
+
+    // SEQUENCE OF
+    if (schema_accept(p, '[')) {
+        node->type = AXDR_TYPE_SEQUENCE_OF;
+        AXDR_SCHEMA* element = (AXDR_SCHEMA*)calloc(1, sizeof(AXDR_SCHEMA));
+        if (!element) {
+            p->failed = 1;
+            return;
+        }
+        node->children = element;
+        node->childCount = 1;
+        schema_parse_field(p, element, depth + 1);
+        schema_expect(p, ']');
+        int64_t maxCount;
+        if (schema_optional_bound(p, &maxCount, 0, UINT32_MAX)) {
+            node->maxLength = (uint32_t)maxCount;
+        }
+        return;
+    }
+
+    const char* word;
+    size_t length = schema_identifier(p, &word);
+    size_t i;
+    for (i = 0; i < sizeof(schema_keywords) / sizeof(schema_keywords[0]); i++) {
+        if (strlen(schema_keywords[i].keyword) == length &&
+            memcmp(schema_keywords[i].keyword, word, length) == 0) {
+            break;
+        }
+    }
+    if (i == sizeof(schema_keywords) / sizeof(schema_keywords[0])) {
+        p->failed = 1;
+        return;
+    }
+
+    node->type = schema_keywords[i].type;
+    int64_t bound;
+    switch (node->type) {
+    case AXDR_TYPE_INTEGER:
+        node->min = INT32_MIN;
+        node->max = INT32_MAX;
+        if (schema_accept(p, '(')) {
+            node->min = schema_number(p, INT32_MIN, INT32_MAX);
+            schema_expect(p, ',');
+            node->max = schema_number(p, INT32_MIN, INT32_MAX);
+            schema_expect(p, ')');
+            if (node->min > node->max) {
+                p->failed = 1;
+            }
+        }
+        break;
+    case AXDR_TYPE_UNSIGNED:
+        node->max = UINT32_MAX;
+        schema_optional_bound(p, &node->max, 0, UINT32_MAX);
+        break;
+    case AXDR_TYPE_ENUM:
+        if (!schema_optional_bound(p, &node->max, 1, INT32_MAX)) {
+            p->failed = 1;
+        }
+        break;
+    case AXDR_TYPE_VISIBLE_STRING:
+    case AXDR_TYPE_VARVISIBLE_STRING:
+    case AXDR_TYPE_OCTET_STRING:
+    case AXDR_TYPE_VAROCTET_STRING:
+        if (schema_optional_bound(p, &bound, 0, UINT32_MAX)) {
+            node->maxLength = (uint32_t)bound;
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+static void schema_parse_field(SCHEMA_PARSER* p, AXDR_SCHEMA* node, int depth) {
+    // 先尝试 name ':'，不是字段名则回退按类型解析
+    size_t mark = p->pos;
+    const char* word;
+    size_t length = schema_identifier(p, &word);
+    if (length > 0 && schema_accept(p, ':')) {
+        char* name = (char*)malloc(length + 1);
+        if (!name) {
+            p->failed = 1;
+            return;
+        }
+        memcpy(name, word, length);
+        name[length] = '\0';
+        node->name = name;
+    } else {
+        p->pos = mark;
+    }
+    schema_parse_type(p, node, depth);
+}
+
+AXDR_SCHEMA* axdr_schema_parse(const char* text) {
+    if (!text) {
+        return NULL;
+    }
+
+    AXDR_SCHEMA* root = (AXDR_SCHEMA*)calloc(1, sizeof(AXDR_SCHEMA));
+    if (!root) {
+        return NULL;
+    }
+
+    SCHEMA_PARSER parser = {text, 0, 0};
+    schema_parse_field(&parser, root, 0);
+    schema_skip_space(&parser);
+    if (parser.failed || text[parser.pos] != '\0') {
+        axdr_schema_free(root);
+        return NULL;
+    }
+    return root;
+}
+
+static void schema_free_node(AXDR_SCHEMA* node) {
+    AXDR_SCHEMA* children = (AXDR_SCHEMA*)node->children;
+    for (size_t i = 0; children && i < node->childCount; i++) {
+        schema_free_node(&children[i]);
+    }
+    free(children);
+    free((char*)node->name);
+}
+
+void axdr_schema_free(AXDR_SCHEMA* schema) {
+    if (schema) {
+        schema_free_node(schema);
+        free(schema);
+    }
+}
@@ -0,0 +1,65 @@
+#ifndef AXDR_SCHEMA_H
+#define AXDR_SCHEMA_H
+
+#include "axdr.h"
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// 数据模式：描述一段A-XDR编码的结构，供导出、遍历等通用处理使用
+
+// 类型定义
+#define AXDR_TYPE_NULL               0
+#define AXDR_TYPE_INTEGER            1
+#define AXDR_TYPE_UNSIGNED           2
+#define AXDR_TYPE_BOOLEAN            3
+#define AXDR_TYPE_ENUM               4
+#define AXDR_TYPE_BIT_STRING         5
+#define AXDR_TYPE_OCTET_STRING       6
+#define AXDR_TYPE_VISIBLE_STRING     7
+#define AXDR_TYPE_GENERALIZED_TIME   8
+#define AXDR_TYPE_VARINT             9
+#define AXDR_TYPE_VAROCTET_STRING    10
+#define AXDR_TYPE_VARVISIBLE_STRING  11
+#define AXDR_TYPE_VARBIT_STRING      12
+#define AXDR_TYPE_SEQUENCE           13
+#define AXDR_TYPE_SEQUENCE_OF        14
+#define AXDR_TYPE_DATE_TIME          15     // 12 字节二进制日期时间，见 axdr_datetime.h
+#define AXDR_TYPE_FLOAT32            16
+#define AXDR_TYPE_FLOAT64            17
+
+typedef struct AXDR_SCHEMA {
+    int         type;           // AXDR_TYPE_*
+    const char* name;           // 字段名（JSON键 / CSV列名），可为 NULL
+    int64_t     min;            // INTEGER 下限
+    int64_t     max;            // INTEGER/UNSIGNED 上限，ENUM 取值个数
+    uint32_t    maxLength;      // 字符串最大长度，SEQUENCE OF 最大元素个数，0 表示不限
+    const struct AXDR_SCHEMA* children;    // SEQUENCE 的字段，SEQUENCE OF 的元素类型
+    size_t      childCount;     // SEQUENCE 的字段个数，SEQUENCE OF 为 1
+    size_t      offset;         // 解码到结构体时字段相对于所在结构体（或数组元素）的偏移
+    size_t      lengthOffset;   // 字节串/位串的实际长度（size_t）相对于所在结构体的偏移
+} AXDR_SCHEMA;
+
+// 解析文本形式的模式，返回动态分配的根节点，失败返回 NULL
+//
+//   field  := [name ':'] type
+//   type   := 'int' ['(' min ',' max ')'] | 'uint' ['(' max ')'] | 'bool' | 'enum' '(' count ')'
+//           | 'bits' | 'octets' | 'string' ['(' maxlen ')'] | 'time' | 'datetime' | 'null'
+//           | 'float32' | 'float64'
+//           | 'varint' | 'varoctets' | 'varstring' ['(' maxlen ')'] | 'varbits'
+//           | '{' field (',' field)* '}'           SEQUENCE
+//           | '[' field ']' ['(' maxcount ')']     SEQUENCE OF
+//
+// 例如 "{id:int, active:bool, name:string(32), readings:[int](96)}"
+// INTEGER 界限须在 int32 范围内且 min <= max，UNSIGNED 上限与长度、个数须在 0..UINT32_MAX，
+// ENUM 取值个数须在 1..INT32_MAX，否则解析失败
+AXDR_SCHEMA* axdr_schema_parse(const char* text);
+void axdr_schema_free(AXDR_SCHEMA* schema);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // AXDR_SCHEMA_H
@@ -0,0 +1,154 @@
+#include "axdr_segment.h"
+#include <string.h>
+
+// 跳过空段，使 offset 始终位于当前段的有效范围内（或已到末尾）
+static void segmented_skip_empty(AXDR_SEGMENTED_CODEC* sc) {
+    while (sc->segment < sc->segmentCount && sc->offset == sc->segments[sc->segment].length) {
+        sc->segment++;
+        sc->offset = 0;
+    }
+}
+
+// 前移 length 字节，可跨段
+static void segmented_advance(AXDR_SEGMENTED_CODEC* sc, size_t length) {
+    sc->consumed += length;
+    while (length > 0) {
+        size_t available = sc->segments[sc->segment].length - sc->offset;
+        if (length < available) {
+            sc->offset += length;
+            break;
+        }
+        length -= available;
+        sc->segment++;
+        sc->offset = 0;
+    }
+    segmented_skip_empty(sc);
+}
+
+// 从当前位置起最多拷贝 length 字节到拼接缓冲区，返回拷贝的字节数
+static size_t segmented_stitch(AXDR_SEGMENTED_CODEC* sc, size_t length) {
+    size_t copied = 0;
+    size_t segment = sc->segment;
+    size_t offset = sc->offset;
+    while (copied < length && segment < sc->segmentCount) {
+        size_t chunk = sc->segments[segment].length - offset;
+        if (chunk > length - copied) {
+            chunk = length - copied;
+        }
+        memcpy(sc->scratch + copied, sc->segments[segment].data + offset, chunk);
+        copied += chunk;
+        segment++;
+        offset = 0;
+    }
+    return copied;
+}
+
+int axdr_segmented_init(AXDR_SEGMENTED_CODEC* sc, const AXDR_SEGMENT* segments, size_t segmentCount,
+                        uint8_t* scratch, size_t scratchSize) {
+    if (!sc || (!segments && segmentCount > 0) || (!scratch && scratchSize > 0)) {
+        return AXDR_ERROR_INVALID_VALUE;
+    }
+
+    sc->segments = segments;
+    sc->segmentCount = segmentCount;
+    sc->segment = 0;
+    sc->offset = 0;
+    sc->consumed = 0;
+    sc->total = 0;
+    for (size_t i = 0; i < segmentCount; i++) {
+        sc->total += segments[i].length;
+    }
+    sc->scratch = scratch;
+    sc->scratchSize = scratchSize;
+    sc->stitched = 0;
+    axdr_codec_attach(&sc->codec, NULL, 0);
+    segmented_skip_empty(sc);
+    return AXDR_SUCCESS;
+}
+
+size_t axdr_segments_from_ring(AXDR_SEGMENT segments[2], const uint8_t* ring, size_t capacity,
+                               size_t start, size_t length) {
+    if (!ring || capacity == 0 || length == 0) {
+        return 0;
+    }
+
+    start %= capacity;
+    if (length > capacity) {
+        length = capacity;
+    }
+    size_t first = capacity - start;
+    segments[0].data = ring + start;
+    if (length <= first) {
+        segments[0].length = length;
+        return 1;
+    }
+    segments[0].length = first;
+    segments[1].data = ring;
+    segments[1].length = length - first;
+    return 2;
+}
+
+AXDR_CODEC* axdr_segmented_begin(AXDR_SEGMENTED_CODEC* sc) {
+    AXDR_DECODE_BUDGET* budget = sc->codec.budget;
+    if (sc->stitched) {
+        axdr_codec_attach(&sc->codec, sc->scratch, sc->stitched);
+    } else if (sc->segment < sc->segmentCount) {
+        const AXDR_SEGMENT* segment = &sc->segments[sc->segment];
+        // 解码函数不写缓冲区
+        axdr_codec_attach(&sc->codec, (uint8_t*)segment->data + sc->offset, segment->length - sc->offset);
+    } else {
+        axdr_codec_attach(&sc->codec, NULL, 0);
+    }
+    sc->codec.budget = budget;
+    if (budget) {
+        sc->budgetMark = *budget;
+    }
+    return &sc->codec;
+}
+
+int axdr_segmented_end(AXDR_SEGMENTED_CODEC* sc, int result) {
+    if (result == AXDR_SUCCESS) {
+        sc->stitched = 0;
+        segmented_advance(sc, sc->codec.position);
+        return AXDR_SUCCESS;
+    }
+
+    if (result == AXDR_ERROR_BUFFER_OVERFLOW) {
+        // 视图之外还有数据：拼接更长的视图重试
+        size_t remaining = sc->total - sc->consumed;
+        size_t viewed = sc->codec.size;
+        if (viewed < remaining && viewed < sc->scratchSize) {
+            size_t want = sc->stitched ? sc->stitched * 2 : AXDR_SEGMENT_STITCH;
+            if (want <= viewed) {
+                want = viewed * 2;
+            }
+            if (want > sc->scratchSize) {
+                want = sc->scratchSize;
+            }
+            sc->stitched = segmented_stitch(sc, want);
+            // 撤销失败尝试计入的用量（含未配对的嵌套深度）
+            if (sc->codec.budget) {
+                *sc->codec.budget = sc->budgetMark;
+            }
+            return AXDR_SEGMENTED_RETRY;
+        }
+    } else if (sc->codec.error != AXDR_SUCCESS) {
+        sc->codec.errorOffset += sc->consumed;
+    }
+
+    sc->stitched = 0;
+    return result;
+}
+
+int axdr_segmented_decode(AXDR_SEGMENTED_CODEC* sc, AXDR_DECODE_FIELD decoder, void* field) {
+    if (!sc || !decoder) {
+        return AXDR_ERROR_INVALID_VALUE;
+    }
+    int result;
+    AXDR_SEGMENTED_DECODE(sc, result, decoder, field);
+    return result;
+}
+
+size_t axdr_segmented_remaining(const AXDR_SEGMENTED_CODEC* sc) {
+    return sc->total - sc->consumed;
+}
@@ -0,0 +1,79 @@
+#ifndef AXDR_SEGMENT_H
+#define AXDR_SEGMENT_H
+
+#include "axdr.h"
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// 分段输入解码
+//
+// 输入由若干 (指针, 长度) 段组成（环形缓冲区回绕的两段、链式网络分段），不预先拼接。
+// 每次解码调用先在当前段剩余部分上构造普通 AXDR_CODEC 视图，现有 axdr_decode_* 函数
+// 原样使用；只有字段跨越段边界导致 AXDR_ERROR_BUFFER_OVERFLOW 时，才把边界附近的字节
+// 拷入调用者提供的拼接缓冲区后重新解码该字段。拼接长度从 AXDR_SEGMENT_STITCH 起按需
+// 倍增，不超过拼接缓冲区大小，因此拼接缓冲区须容纳跨边界的最大单个字段。
+//
+// 按字段（或按元素）逐个调用，使需要拼接的只有跨边界的那个字段。
+// 零拷贝解码（如 axdr_decode_bitmap）的结果可能指向拼接缓冲区，下一次解码前有效。
+// 解码失败时 codec.errorOffset 换算为相对整个输入起点的偏移。
+// 需要解码预算时在 axdr_segmented_init 之后设置 codec.budget，各次视图保留该设置；
+// 因跨边界失败而重试的那次尝试所计入的用量在重试前撤销，不会重复计入。
+
+#define AXDR_SEGMENT_STITCH  64
+
+// 输入段，解码过程中不会被修改
+typedef struct {
+    const uint8_t* data;
+    size_t         length;
+} AXDR_SEGMENT;
+
+typedef struct {
+    const AXDR_SEGMENT* segments;
+    size_t     segmentCount;
+    size_t     segment;         // 当前段
+    size_t     offset;          // 当前段内已读取的字节数
+    size_t     consumed;        // 已读取的总字节数
+    size_t     total;           // 输入总字节数
+    uint8_t*   scratch;         // 拼接缓冲区
+    size_t     scratchSize;
+    size_t     stitched;        // 当前视图为拼接缓冲区时的拼接字节数，否则为 0
+    AXDR_CODEC codec;           // 传给解码函数的视图
+    AXDR_DECODE_BUDGET budgetMark;  // 本次尝试开始时的预算用量，重试前恢复
+} AXDR_SEGMENTED_CODEC;
+
+// axdr_segmented_end 要求以更长的拼接视图重新解码当前字段
+#define AXDR_SEGMENTED_RETRY  1
+
+int axdr_segmented_init(AXDR_SEGMENTED_CODEC* sc, const AXDR_SEGMENT* segments, size_t segmentCount,
+                        uint8_t* scratch, size_t scratchSize);
+
+// 环形缓冲区中从 start 开始的 length 字节，回绕时拆成两段，返回段数
+size_t axdr_segments_from_ring(AXDR_SEGMENT segments[2], const uint8_t* ring, size_t capacity,
+                               size_t start, size_t length);
+
+// 单个字段的解码：begin 返回本次使用的视图，end 传入解码结果，
+// 成功时前移读取位置，返回 AXDR_SEGMENTED_RETRY 时应以新视图再调用一次
+AXDR_CODEC* axdr_segmented_begin(AXDR_SEGMENTED_CODEC* sc);
+int axdr_segmented_end(AXDR_SEGMENTED_CODEC* sc, int result);
+
+// 以 AXDR_DECODE_FIELD 解码一个字段
+int axdr_segmented_decode(AXDR_SEGMENTED_CODEC* sc, AXDR_DECODE_FIELD decoder, void* field);
+
+// 直接调用任一 axdr_decode_* 函数，codec 参数由宏填入：
+//   AXDR_SEGMENTED_DECODE(&sc, result, axdr_decode_integer, &value, -100, 100);
+#define AXDR_SEGMENTED_DECODE(sc, result, decode, ...)                          \
+    do {                                                                        \
+        (result) = decode(axdr_segmented_begin(sc), ##__VA_ARGS__);             \
+    } while (((result) = axdr_segmented_end((sc), (result))) == AXDR_SEGMENTED_RETRY)
+
+// 剩余未读取的字节数
+size_t axdr_segmented_remaining(const AXDR_SEGMENTED_CODEC* sc);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // AXDR_SEGMENT_H
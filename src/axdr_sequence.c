@@ -35,18 +35,23 @@ int axdr_decode_sequence(AXDR_CODEC* codec, void* sequence,
     // sequence是一个指向字段数组的指针
     void** fields = (void**)sequence;
 
-    for (size_t i = 0; i < fieldCount; i++) {
-        if (!decoders[i] || !fields[i]) {
-            return AXDR_ERROR_INVALID_VALUE;
-        }
+    // 预算：嵌套深度，每个字段计 1 个工作量
+    int result = axdr_budget_enter(codec);
+    if (result != AXDR_SUCCESS) {
+        return result;
+    }
+    result = axdr_budget_work(codec, fieldCount);
 
-        int result = decoders[i](codec, fields[i]);
-        if (result != AXDR_SUCCESS) {
-            return result;
+    for (size_t i = 0; result == AXDR_SUCCESS && i < fieldCount; i++) {
+        if (!decoders[i] || !fields[i]) {
+            result = AXDR_ERROR_INVALID_VALUE;
+            break;
         }
+        result = decoders[i](codec, fields[i]);
     }
 
-    return AXDR_SUCCESS;
+    axdr_budget_leave(codec);
+    return result;
 }
 
 // SEQUENCE OF编解码函数
@@ -91,6 +96,16 @@ int axdr_decode_sequence_of(AXDR_CODEC* codec, AXDR_SEQUENCE_OF* sequence,
         return AXDR_ERROR_CONSTRAINT;
     }
 
+    // 预算：元素个数在循环前一次性计入，超出时不解码任何元素
+    result = axdr_budget_elements(codec, count);
+    if (result != AXDR_SUCCESS) {
+        return result;
+    }
+    result = axdr_budget_enter(codec);
+    if (result != AXDR_SUCCESS) {
+        return result;
+    }
+
     sequence->count = count;
 
     // 解码每个元素
@@ -98,11 +113,12 @@ int axdr_decode_sequence_of(AXDR_CODEC* codec, AXDR_SEQUENCE_OF* sequence,
     for (size_t i = 0; i < count; i++) {
         result = elementDecoder(codec, elementPtr + i * sequence->elementSize);
         if (result != AXDR_SUCCESS) {
-            return result;
+            break;
         }
     }
 
-    return AXDR_SUCCESS;
+    axdr_budget_leave(codec);
+    return result;
 }
 
 // 带参数的SEQUENCE编解码函数
@@ -136,16 +152,20 @@ int axdr_decode_sequence_with_params(AXDR_CODEC* codec,
         return AXDR_ERROR_INVALID_VALUE;
     }
     
-    for (size_t i = 0; i < paramCount; i++) {
+    int result = axdr_budget_enter(codec);
+    if (result != AXDR_SUCCESS) {
+        return result;
+    }
+    result = axdr_budget_work(codec, paramCount);
+
+    for (size_t i = 0; result == AXDR_SUCCESS && i < paramCount; i++) {
         if (!params[i].value) {
-            return AXDR_ERROR_INVALID_VALUE;
-        }
-        
-        int result = encoder(codec, params[i].value, params[i].type);
-        if (result != AXDR_SUCCESS) {
-            return result;
+            result = AXDR_ERROR_INVALID_VALUE;
+            break;
         }
+        result = encoder(codec, params[i].value, params[i].type);
     }
-    
-    return AXDR_SUCCESS;
+
+    axdr_budget_leave(codec);
+    return result;
 }
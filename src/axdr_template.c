@@ -0,0 +1,150 @@
+#include "axdr_template.h"
+#include <stdlib.h>
+#include <string.h>
+
+// 录制实现
+int axdr_template_begin(AXDR_TEMPLATE* tpl, AXDR_CODEC* codec) {
+    if (!tpl || !codec) {
+        return AXDR_ERROR_INVALID_VALUE;
+    }
+    memset(tpl, 0, sizeof(AXDR_TEMPLATE));
+    tpl->recording = codec;
+    tpl->start = codec->position;
+    return AXDR_SUCCESS;
+}
+
+int axdr_template_field_begin(AXDR_TEMPLATE* tpl, size_t fieldId) {
+    if (!tpl || !tpl->recording || fieldId >= AXDR_TEMPLATE_MAX_FIELDS) {
+        return AXDR_ERROR_INVALID_VALUE;
+    }
+    tpl->fields[fieldId].offset = tpl->recording->position - tpl->start;
+    tpl->fields[fieldId].width = 0;
+    if (fieldId >= tpl->fieldCount) {
+        tpl->fieldCount = fieldId + 1;
+    }
+    return AXDR_SUCCESS;
+}
+
+int axdr_template_field_end(AXDR_TEMPLATE* tpl, size_t fieldId) {
+    if (!tpl || !tpl->recording || fieldId >= tpl->fieldCount) {
+        return AXDR_ERROR_INVALID_VALUE;
+    }
+    size_t end = tpl->recording->position - tpl->start;
+    if (end < tpl->fields[fieldId].offset) {
+        return AXDR_ERROR_INVALID_VALUE;
+    }
+    tpl->fields[fieldId].width = end - tpl->fields[fieldId].offset;
+    return AXDR_SUCCESS;
+}
+
+int axdr_template_end(AXDR_TEMPLATE* tpl) {
+    if (!tpl || !tpl->recording) {
+        return AXDR_ERROR_INVALID_VALUE;
+    }
+
+    size_t length = tpl->recording->position - tpl->start;
+    tpl->bytes = (uint8_t*)malloc(length > 0 ? length : 1);
+    if (!tpl->bytes) {
+        return AXDR_ERROR_BUFFER_OVERFLOW;
+    }
+    memcpy(tpl->bytes, tpl->recording->buffer + tpl->start, length);
+    tpl->length = length;
+    tpl->recording = NULL;
+    return AXDR_SUCCESS;
+}
+
+void axdr_template_cleanup(AXDR_TEMPLATE* tpl) {
+    if (tpl) {
+        free(tpl->bytes);
+        tpl->bytes = NULL;
+        tpl->length = 0;
+        tpl->fieldCount = 0;
+    }
+}
+
+// 实例化实现
+int axdr_template_instantiate(const AXDR_TEMPLATE* tpl, AXDR_CODEC* codec, size_t* messageStart) {
+    if (!tpl || !tpl->bytes || !codec) {
+        return AXDR_ERROR_INVALID_VALUE;
+    }
+    if (codec->position + tpl->length > codec->size) {
+        return AXDR_ERROR_BUFFER_OVERFLOW;
+    }
+
+    memcpy(codec->buffer + codec->position, tpl->bytes, tpl->length);
+    if (messageStart) {
+        *messageStart = codec->position;
+    }
+    codec->position += tpl->length;
+    return AXDR_SUCCESS;
+}
+
+// 取得字段所在的编码窗口，窗口大小等于字段宽度
+static int template_window(const AXDR_TEMPLATE* tpl, AXDR_CODEC* codec, size_t messageStart,
+                           size_t fieldId, AXDR_CODEC* window) {
+    if (!tpl || !codec || fieldId >= tpl->fieldCount) {
+        return AXDR_ERROR_INVALID_VALUE;
+    }
+    if (messageStart + tpl->length > codec->size) {
+        return AXDR_ERROR_BUFFER_OVERFLOW;
+    }
+    const AXDR_TEMPLATE_FIELD* field = &tpl->fields[fieldId];
+    axdr_codec_attach(window, codec->buffer + messageStart + field->offset, field->width);
+    return AXDR_SUCCESS;
+}
+
+// 窗口写满才说明宽度一致；写不下说明变长字段变长了
+static int template_check(int result, const AXDR_CODEC* window) {
+    if (result == AXDR_ERROR_BUFFER_OVERFLOW ||
+        (result == AXDR_SUCCESS && window->position != window->size)) {
+        return AXDR_ERROR_LAYOUT_CHANGED;
+    }
+    return result;
+}
+
+int axdr_template_patch_integer(const AXDR_TEMPLATE* tpl, AXDR_CODEC* codec, size_t messageStart,
+                                size_t fieldId, int32_t value, int32_t min, int32_t max) {
+    AXDR_CODEC window;
+    int result = template_window(tpl, codec, messageStart, fieldId, &window);
+    if (result != AXDR_SUCCESS) {
+        return result;
+    }
+    return template_check(axdr_encode_integer(&window, value, min, max), &window);
+}
+
+int axdr_template_patch_unsigned(const AXDR_TEMPLATE* tpl, AXDR_CODEC* codec, size_t messageStart,
+                                 size_t fieldId, uint32_t value, uint32_t max) {
+    AXDR_CODEC window;
+    int result = template_window(tpl, codec, messageStart, fieldId, &window);
+    if (result != AXDR_SUCCESS) {
+        return result;
+    }
+    return template_check(axdr_encode_unsigned(&window, value, max), &window);
+}
+
+int axdr_template_patch_octet_string(const AXDR_TEMPLATE* tpl, AXDR_CODEC* codec, size_t messageStart,
+                                     size_t fieldId, const uint8_t* octets, size_t length) {
+    AXDR_CODEC window;
+    int result = template_window(tpl, codec, messageStart, fieldId, &window);
+    if (result != AXDR_SUCCESS) {
+        return result;
+    }
+    // 长度不同则整个消息布局改变，写入前就拒绝
+    if (4 + length != window.size) {
+        return AXDR_ERROR_LAYOUT_CHANGED;
+    }
+    return template_check(axdr_encode_octet_string(&window, octets, length), &window);
+}
+
+int axdr_template_patch_field(const AXDR_TEMPLATE* tpl, AXDR_CODEC* codec, size_t messageStart,
+                              size_t fieldId, AXDR_ENCODE_FIELD encoder, const void* value) {
+    if (!encoder) {
+        return AXDR_ERROR_INVALID_VALUE;
+    }
+    AXDR_CODEC window;
+    int result = template_window(tpl, codec, messageStart, fieldId, &window);
+    if (result != AXDR_SUCCESS) {
+        return result;
+    }
+    return template_check(encoder(&window, value), &window);
+}
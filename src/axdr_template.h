@@ -0,0 +1,60 @@
+#ifndef AXDR_TEMPLATE_H
+#define AXDR_TEMPLATE_H
+
+#include "axdr.h"
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// 预编码消息模板
+//
+// 先完整编码一次消息，并在编码过程中标记可变字段的偏移和宽度；之后生成新消息时
+// 只需拷贝模板字节并原地改写这些字段。定长字段（整数、布尔、枚举等）改写后布局不变；
+// 变长字段改写后长度不同时返回 AXDR_ERROR_LAYOUT_CHANGED，调用者应退回完整编码。
+
+#define AXDR_TEMPLATE_MAX_FIELDS  16
+
+typedef struct {
+    size_t offset;      // 字段在消息中的偏移
+    size_t width;       // 字段编码后的字节数
+} AXDR_TEMPLATE_FIELD;
+
+typedef struct {
+    uint8_t*            bytes;          // 模板消息
+    size_t              length;         // 模板消息长度
+    AXDR_TEMPLATE_FIELD fields[AXDR_TEMPLATE_MAX_FIELDS];
+    size_t              fieldCount;
+    AXDR_CODEC*         recording;      // 录制中的编码上下文
+    size_t              start;          // 录制开始时的位置
+} AXDR_TEMPLATE;
+
+// 录制：在 codec 上正常编码消息，可变字段前后分别调用 field_begin/field_end
+int axdr_template_begin(AXDR_TEMPLATE* tpl, AXDR_CODEC* codec);
+int axdr_template_field_begin(AXDR_TEMPLATE* tpl, size_t fieldId);
+int axdr_template_field_end(AXDR_TEMPLATE* tpl, size_t fieldId);
+// 结束录制，复制 [begin, 当前位置) 的编码结果作为模板
+int axdr_template_end(AXDR_TEMPLATE* tpl);
+void axdr_template_cleanup(AXDR_TEMPLATE* tpl);
+
+// 把模板拷贝到 codec 当前位置，返回消息在 codec 中的起始位置。
+// 拷贝的字节尚未计入校验（axdr_crc.h），改写完字段后再继续编码或追加 FCS
+int axdr_template_instantiate(const AXDR_TEMPLATE* tpl, AXDR_CODEC* codec, size_t* messageStart);
+
+// 在已实例化的消息中改写字段：messageStart 为 instantiate 返回的起始位置
+int axdr_template_patch_integer(const AXDR_TEMPLATE* tpl, AXDR_CODEC* codec, size_t messageStart,
+                                size_t fieldId, int32_t value, int32_t min, int32_t max);
+int axdr_template_patch_unsigned(const AXDR_TEMPLATE* tpl, AXDR_CODEC* codec, size_t messageStart,
+                                 size_t fieldId, uint32_t value, uint32_t max);
+int axdr_template_patch_octet_string(const AXDR_TEMPLATE* tpl, AXDR_CODEC* codec, size_t messageStart,
+                                     size_t fieldId, const uint8_t* octets, size_t length);
+// 通用改写：用任意字段编码器在原位置重新编码，宽度必须与模板一致
+int axdr_template_patch_field(const AXDR_TEMPLATE* tpl, AXDR_CODEC* codec, size_t messageStart,
+                              size_t fieldId, AXDR_ENCODE_FIELD encoder, const void* value);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // AXDR_TEMPLATE_H
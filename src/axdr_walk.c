@@ -0,0 +1,294 @@
+#include "axdr_walk.h"
+#include "axdr_datetime.h"
+#include <string.h>
+
+int axdr_walker_init(AXDR_WALKER* walker, AXDR_WALK_FRAME* frames, size_t maxDepth) {
+    if (!walker || !frames || maxDepth == 0) {
+        return AXDR_ERROR_INVALID_VALUE;
+    }
+    walker->frames = frames;
+    walker->capacity = maxDepth;
+    walker->depth = 0;
+    return AXDR_SUCCESS;
+}
+
+// 解码一个叶子节点；container 为 NULL 时只校验并跳过
+static int walk_leaf(AXDR_CODEC* codec, const AXDR_SCHEMA* node, uint8_t* container) {
+    uint8_t* field = container ? container + node->offset : NULL;
+    int result;
+
+    switch (node->type) {
+    case AXDR_TYPE_NULL:
+        return axdr_decode_null(codec);
+
+    case AXDR_TYPE_INTEGER: {
+        int32_t value;
+        int32_t min = node->min < INT32_MIN ? INT32_MIN : (int32_t)node->min;
+        int32_t max = node->max > INT32_MAX ? INT32_MAX : (int32_t)node->max;
+        result = axdr_decode_integer(codec, &value, min, max);
+        if (result == AXDR_SUCCESS && field) {
+            *(int32_t*)field = value;
+        }
+        return result;
+    }
+
+    case AXDR_TYPE_UNSIGNED: {
+        uint32_t value;
+        uint32_t max = node->max > UINT32_MAX || node->max < 0 ? UINT32_MAX : (uint32_t)node->max;
+        result = axdr_decode_unsigned(codec, &value, max);
+        if (result == AXDR_SUCCESS && field) {
+            *(uint32_t*)field = value;
+        }
+        return result;
+    }
+
+    case AXDR_TYPE_BOOLEAN: {
+        bool value;
+        result = axdr_decode_boolean(codec, &value);
+        if (result == AXDR_SUCCESS && field) {
+            *(bool*)field = value;
+        }
+        return result;
+    }
+
+    case AXDR_TYPE_ENUM: {
+        int value;
+        result = axdr_decode_enum(codec, &value, (int)node->max);
+        if (result == AXDR_SUCCESS && field) {
+            *(int*)field = value;
+        }
+        return result;
+    }
+
+    case AXDR_TYPE_VARINT: {
+        int32_t value;
+        result = axdr_decode_varint(codec, &value);
+        if (result == AXDR_SUCCESS && field) {
+            *(int32_t*)field = value;
+        }
+        return result;
+    }
+
+    case AXDR_TYPE_GENERALIZED_TIME: {
+        time_t value;
+        result = axdr_decode_generalized_time(codec, &value);
+        if (result == AXDR_SUCCESS && field) {
+            *(time_t*)field = value;
+        }
+        return result;
+    }
+
+    case AXDR_TYPE_FLOAT32: {
+        float value;
+        result = axdr_decode_float32(codec, &value);
+        if (result == AXDR_SUCCESS && field) {
+            *(float*)field = value;
+        }
+        return result;
+    }
+
+    case AXDR_TYPE_FLOAT64: {
+        double value;
+        result = axdr_decode_float64(codec, &value);
+        if (result == AXDR_SUCCESS && field) {
+            *(double*)field = value;
+        }
+        return result;
+    }
+
+    case AXDR_TYPE_DATE_TIME: {
+        AXDR_DATE_TIME value;
+        result = axdr_decode_date_time(codec, &value);
+        if (result == AXDR_SUCCESS && field) {
+            *(AXDR_DATE_TIME*)field = value;
+        }
+        return result;
+    }
+
+    case AXDR_TYPE_BIT_STRING:
+    case AXDR_TYPE_OCTET_STRING:
+    case AXDR_TYPE_VISIBLE_STRING:
+    case AXDR_TYPE_VARBIT_STRING:
+    case AXDR_TYPE_VAROCTET_STRING:
+    case AXDR_TYPE_VARVISIBLE_STRING:
+        break;
+
+    default:
+        return AXDR_ERROR_INVALID_TYPE;
+    }
+
+    // 长度前缀的字符串类型
+    size_t length;
+    if (node->type == AXDR_TYPE_VARBIT_STRING || node->type == AXDR_TYPE_VAROCTET_STRING ||
+        node->type == AXDR_TYPE_VARVISIBLE_STRING) {
+        int32_t value;
+        result = axdr_decode_varint(codec, &value);
+        if (result == AXDR_SUCCESS && value < 0) {
+            result = AXDR_ERROR_CONSTRAINT;
+        }
+        length = (size_t)(uint32_t)value;
+    } else {
+        uint32_t value;
+        result = axdr_decode_unsigned(codec, &value, UINT32_MAX);
+        length = value;
+    }
+    if (result != AXDR_SUCCESS) {
+        return result;
+    }
+
+    if (node->maxLength > 0 && length > node->maxLength) {
+        return AXDR_ERROR_CONSTRAINT;
+    }
+    // 写入结构体时必须知道目标数组的容量
+    if (field && node->maxLength == 0) {
+        return AXDR_ERROR_INVALID_LENGTH;
+    }
+
+    int bits = node->type == AXDR_TYPE_BIT_STRING || node->type == AXDR_TYPE_VARBIT_STRING;
+    size_t bytes = bits ? (length + 7) / 8 : length;
+    if (bytes > codec->size - codec->position) {
+        return AXDR_ERROR_BUFFER_OVERFLOW;
+    }
+
+    if (field) {
+        result = axdr_budget_output(codec, bytes);
+        if (result != AXDR_SUCCESS) {
+            return result;
+        }
+    }
+    const uint8_t* src = codec->buffer + codec->position;
+    if (node->type == AXDR_TYPE_VISIBLE_STRING) {
+        // 与 axdr_decode_visible_string 相同的字符范围校验，不写入结构体时也校验
+        size_t valid = axdr_visible_copy(src, length, field);
+        if (valid != length) {
+            codec->error = AXDR_ERROR_INVALID_VALUE;
+            codec->errorOffset = codec->position + valid;
+            return AXDR_ERROR_INVALID_VALUE;
+        }
+        if (field) {
+            field[length] = '\0';
+        }
+    } else if (node->type == AXDR_TYPE_VARVISIBLE_STRING) {
+        if (field) {
+            memcpy(field, src, bytes);
+            field[length] = '\0';
+        }
+    } else if (field) {
+        memcpy(field, src, bytes);
+        *(size_t*)(container + node->lengthOffset) = length;
+    }
+    codec->position += bytes;
+    axdr_checksum_fold(codec);
+    return AXDR_SUCCESS;
+}
+
+static int walk_run(AXDR_WALKER* walker, AXDR_CODEC* codec, const AXDR_SCHEMA* schema, void* dest) {
+    walker->depth = 0;
+    const AXDR_SCHEMA* node = schema;
+    uint8_t* container = (uint8_t*)dest;
+    AXDR_WALK_FRAME* frame;
+
+    for (;;) {
+        // 处理当前节点：容器入栈，叶子直接解码
+        if (node->type == AXDR_TYPE_SEQUENCE || node->type == AXDR_TYPE_SEQUENCE_OF) {
+            if (walker->depth == walker->capacity) {
+                return AXDR_ERROR_CONSTRAINT;
+            }
+            int result = axdr_budget_enter(codec);
+            if (result != AXDR_SUCCESS) {
+                return result;
+            }
+            frame = &walker->frames[walker->depth];
+            frame->schema = node;
+            frame->index = 0;
+            uint8_t* field = container ? container + node->offset : NULL;
+
+            if (node->type == AXDR_TYPE_SEQUENCE) {
+                if (node->childCount > 0 && !node->children) {
+                    return AXDR_ERROR_INVALID_TYPE;
+                }
+                result = axdr_budget_work(codec, node->childCount);
+                if (result != AXDR_SUCCESS) {
+                    return result;
+                }
+                frame->base = field;
+                frame->elementSize = 0;
+                frame->count = node->childCount;
+            } else {
+                if (node->childCount != 1 || !node->children) {
+                    return AXDR_ERROR_INVALID_TYPE;
+                }
+                AXDR_SEQUENCE_OF* sequence = (AXDR_SEQUENCE_OF*)field;
+                uint32_t maxCount = node->maxLength > 0 ? node->maxLength : UINT32_MAX;
+                if (sequence) {
+                    if (!sequence->elements) {
+                        return AXDR_ERROR_INVALID_VALUE;
+                    }
+                    if (sequence->maxCount < maxCount) {
+                        maxCount = (uint32_t)sequence->maxCount;
+                    }
+                }
+
+                uint32_t count;
+                result = axdr_decode_unsigned(codec, &count, maxCount);
+                if (result == AXDR_SUCCESS) {
+                    result = axdr_budget_elements(codec, count);
+                }
+                if (result != AXDR_SUCCESS) {
+                    return result;
+                }
+                if (sequence) {
+                    sequence->count = count;
+                    frame->base = (uint8_t*)sequence->elements;
+                    frame->elementSize = sequence->elementSize;
+                } else {
+                    frame->base = NULL;
+                    frame->elementSize = 0;
+                }
+                frame->count = count;
+            }
+            walker->depth++;
+        } else {
+            int result = walk_leaf(codec, node, container);
+            if (result != AXDR_SUCCESS) {
+                return result;
+            }
+        }
+
+        // 取下一个节点：弹出已处理完的栈帧
+        for (;;) {
+            if (walker->depth == 0) {
+                return AXDR_SUCCESS;
+            }
+            frame = &walker->frames[walker->depth - 1];
+            if (frame->index < frame->count) {
+                break;
+            }
+            walker->depth--;
+            axdr_budget_leave(codec);
+        }
+
+        size_t index = frame->index++;
+        if (frame->schema->type == AXDR_TYPE_SEQUENCE) {
+            node = &frame->schema->children[index];
+            container = frame->base;
+        } else {
+            node = frame->schema->children;
+            container = frame->base ? frame->base + index * frame->elementSize : NULL;
+        }
+    }
+}
+
+int axdr_walk_decode(AXDR_WALKER* walker, AXDR_CODEC* codec, const AXDR_SCHEMA* schema, void* dest) {
+    if (!walker || !walker->frames || !codec || !schema) {
+        return AXDR_ERROR_INVALID_VALUE;
+    }
+
+    // 出错时栈中尚未弹出的层次不再逐层离开，直接恢复进入前的预算深度
+    size_t depth = codec->budget ? codec->budget->depth : 0;
+    int result = walk_run(walker, codec, schema, dest);
+    if (codec->budget) {
+        codec->budget->depth = depth;
+    }
+    return result;
+}
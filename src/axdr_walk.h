@@ -0,0 +1,59 @@
+#ifndef AXDR_WALK_H
+#define AXDR_WALK_H
+
+#include "axdr_schema.h"
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// 按模式迭代解码嵌套的 SEQUENCE / SEQUENCE OF
+//
+// 不经过逐层的字段回调，也不递归：嵌套层次保存在调用者预先分配的显式栈中，
+// 由单个分派循环处理，栈满即返回 AXDR_ERROR_CONSTRAINT。
+//
+// 各类型在目标结构体中的存放方式（位于 schema->offset 处）：
+//   INTEGER / VARINT            int32_t
+//   UNSIGNED                    uint32_t
+//   BOOLEAN                     bool
+//   ENUM                        int
+//   GENERALIZED TIME            time_t
+//   DATE TIME                   AXDR_DATE_TIME
+//   FLOAT32 / FLOAT64           float / double
+//   VISIBLE STRING（含 var）    char[maxLength + 1]，以 '\0' 结尾
+//   OCTET STRING（含 var）      uint8_t[maxLength]，字节数写入 lengthOffset 处的 size_t
+//   BIT STRING（含 var）        uint8_t[(maxLength + 7) / 8]，位数写入 lengthOffset 处的 size_t
+//   SEQUENCE                    嵌套结构体，子字段偏移相对于该结构体
+//   SEQUENCE OF                 AXDR_SEQUENCE_OF，elements/elementSize/maxCount 由调用者预先设置，
+//                               元素模式的偏移相对于每个元素
+//   NULL                        不占空间
+
+#define AXDR_WALK_DEFAULT_DEPTH  16
+
+// 栈帧：一个正在解码的 SEQUENCE 或 SEQUENCE OF
+typedef struct {
+    const AXDR_SCHEMA* schema;      // 容器节点
+    uint8_t*           base;        // SEQUENCE 的结构体地址 / SEQUENCE OF 的元素数组
+    size_t             elementSize; // SEQUENCE OF 元素大小
+    size_t             index;       // 下一个字段或元素的序号
+    size_t             count;       // 字段个数或元素个数
+} AXDR_WALK_FRAME;
+
+typedef struct {
+    AXDR_WALK_FRAME* frames;        // 调用者提供的栈
+    size_t           capacity;      // 最大嵌套深度
+    size_t           depth;         // 当前深度，出错时指示出错位置的深度
+} AXDR_WALKER;
+
+// frames 至少容纳 maxDepth 个栈帧
+int axdr_walker_init(AXDR_WALKER* walker, AXDR_WALK_FRAME* frames, size_t maxDepth);
+
+// 按模式解码到 dest；dest 为 NULL 时只校验并跳过编码数据
+int axdr_walk_decode(AXDR_WALKER* walker, AXDR_CODEC* codec, const AXDR_SCHEMA* schema, void* dest);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // AXDR_WALK_H
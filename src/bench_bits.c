@@ -0,0 +1,78 @@
+#include "axdr_bits.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+// 布尔数组编解码的性能测试：逐元素 SEQUENCE OF BOOLEAN 与压缩位图对比
+// 用法: bench_bits [标志个数] [迭代次数]
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static int encode_flag(AXDR_CODEC* codec, const void* field) {
+    return axdr_encode_boolean(codec, *(const bool*)field);
+}
+
+static int decode_flag(AXDR_CODEC* codec, void* field) {
+    return axdr_decode_boolean(codec, (bool*)field);
+}
+
+int main(int argc, char** argv) {
+    size_t count = argc > 1 ? strtoul(argv[1], NULL, 10) : 512;
+    size_t rounds = argc > 2 ? strtoul(argv[2], NULL, 10) : 100000;
+
+    bool* values = (bool*)malloc(count);
+    bool* decoded = (bool*)malloc(count);
+    uint8_t* buffer = (uint8_t*)malloc(count + 8);
+    if (!values || !decoded || !buffer) {
+        return 1;
+    }
+    for (size_t i = 0; i < count; i++) {
+        values[i] = (i * 2654435761u) & 0x100;
+    }
+
+    AXDR_CODEC codec;
+    AXDR_SEQUENCE_OF sequence = {values, sizeof(bool), count, count};
+    AXDR_SEQUENCE_OF target = {decoded, sizeof(bool), 0, count};
+    int errors = 0;
+    size_t sequenceBytes = 0;
+    size_t packedBytes = 0;
+
+    printf("Boolean array benchmark, %zu flags x %zu rounds\n", count, rounds);
+
+    double start = now_seconds();
+    for (size_t r = 0; r < rounds; r++) {
+        axdr_codec_attach(&codec, buffer, count + 8);
+        errors |= axdr_encode_sequence_of(&codec, &sequence, encode_flag);
+        sequenceBytes = codec.position;
+        codec.size = codec.position;
+        codec.position = 0;
+        errors |= axdr_decode_sequence_of(&codec, &target, decode_flag);
+    }
+    double sequenceTime = now_seconds() - start;
+
+    start = now_seconds();
+    for (size_t r = 0; r < rounds; r++) {
+        size_t decodedCount;
+        axdr_codec_attach(&codec, buffer, count + 8);
+        errors |= axdr_encode_boolean_array(&codec, values, count);
+        packedBytes = codec.position;
+        codec.size = codec.position;
+        codec.position = 0;
+        errors |= axdr_decode_boolean_array(&codec, decoded, &decodedCount, count);
+    }
+    double packedTime = now_seconds() - start;
+
+    double flags = (double)rounds * count;
+    printf("sequence of boolean: %8.3f ns/flag, %zu bytes\n", sequenceTime * 1e9 / flags, sequenceBytes);
+    printf("packed bitmap:       %8.3f ns/flag, %zu bytes\n", packedTime * 1e9 / flags, packedBytes);
+    printf("(errors %d)\n", errors);
+
+    free(values);
+    free(decoded);
+    free(buffer);
+    return 0;
+}
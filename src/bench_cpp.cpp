@@ -0,0 +1,133 @@
+#include "axdr.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+
+// C++ 前端与 C 回调接口（AXDR_ENCODE_PARAMS + 字段编码回调）的性能对比
+// 用法: bench_cpp [迭代次数]
+
+#define BENCH_RECORDS 1024
+
+struct Sample {
+    int32_t  value;
+    uint32_t status;
+    bool     valid;
+    int32_t  scaler;
+    uint32_t time;
+    int      unit;
+
+    static constexpr auto axdr_fields() {
+        return axdr::fields(axdr::field<&Sample::value, axdr::integer<-1000000, 1000000>>{},
+                            axdr::field<&Sample::status, axdr::unsigned_integer<0xFFFF>>{},
+                            axdr::field<&Sample::valid, axdr::boolean>{},
+                            axdr::field<&Sample::scaler, axdr::integer<-10, 10>>{},
+                            axdr::field<&Sample::time, axdr::unsigned_integer<>>{},
+                            axdr::field<&Sample::unit, axdr::enumerated<64>>{});
+    }
+};
+
+#define FIELD_VALUE   0
+#define FIELD_STATUS  1
+#define FIELD_VALID   2
+#define FIELD_SCALER  3
+#define FIELD_TIME    4
+#define FIELD_UNIT    5
+
+static int encode_sample_field(AXDR_CODEC* codec, const void* field, int type) {
+    switch (type) {
+    case FIELD_VALUE:  return axdr_encode_integer(codec, *(const int32_t*)field, -1000000, 1000000);
+    case FIELD_STATUS: return axdr_encode_unsigned(codec, *(const uint32_t*)field, 0xFFFF);
+    case FIELD_VALID:  return axdr_encode_boolean(codec, *(const bool*)field);
+    case FIELD_SCALER: return axdr_encode_integer(codec, *(const int32_t*)field, -10, 10);
+    case FIELD_TIME:   return axdr_encode_unsigned(codec, *(const uint32_t*)field, UINT32_MAX);
+    case FIELD_UNIT:   return axdr_encode_enum(codec, *(const int*)field, 64);
+    default:           return AXDR_ERROR_INVALID_TYPE;
+    }
+}
+
+static int decode_sample_field(AXDR_CODEC* codec, const void* field, int type) {
+    void* target = const_cast<void*>(field);
+    switch (type) {
+    case FIELD_VALUE:  return axdr_decode_integer(codec, (int32_t*)target, -1000000, 1000000);
+    case FIELD_STATUS: return axdr_decode_unsigned(codec, (uint32_t*)target, 0xFFFF);
+    case FIELD_VALID:  return axdr_decode_boolean(codec, (bool*)target);
+    case FIELD_SCALER: return axdr_decode_integer(codec, (int32_t*)target, -10, 10);
+    case FIELD_TIME:   return axdr_decode_unsigned(codec, (uint32_t*)target, UINT32_MAX);
+    case FIELD_UNIT:   return axdr_decode_enum(codec, (int*)target, 64);
+    default:           return AXDR_ERROR_INVALID_TYPE;
+    }
+}
+
+static double now_seconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int main(int argc, char** argv) {
+    size_t rounds = argc > 1 ? std::strtoul(argv[1], NULL, 10) : 5000;
+    static Sample samples[BENCH_RECORDS];
+    static Sample decoded[BENCH_RECORDS];
+    static uint8_t buffer[BENCH_RECORDS * 32];
+    for (int i = 0; i < BENCH_RECORDS; i++) {
+        samples[i] = {i * 37 - 5000, (uint32_t)i & 0xFFFF, (i & 1) != 0, -2, 1700000000u + i, i % 64};
+    }
+
+    AXDR_CODEC codec;
+    int errors = 0;
+    std::printf("C++ front-end benchmark, %zu x %d records\n", rounds, BENCH_RECORDS);
+
+    // C 回调接口
+    double start = now_seconds();
+    for (size_t r = 0; r < rounds; r++) {
+        axdr_codec_attach(&codec, buffer, sizeof(buffer));
+        for (int i = 0; i < BENCH_RECORDS; i++) {
+            const Sample& s = samples[i];
+            AXDR_ENCODE_PARAMS params[6] = {
+                {&s.value, FIELD_VALUE}, {&s.status, FIELD_STATUS}, {&s.valid, FIELD_VALID},
+                {&s.scaler, FIELD_SCALER}, {&s.time, FIELD_TIME}, {&s.unit, FIELD_UNIT}};
+            errors |= axdr_encode_sequence_with_params(&codec, params, 6, encode_sample_field);
+        }
+    }
+    double cEncode = now_seconds() - start;
+
+    start = now_seconds();
+    for (size_t r = 0; r < rounds; r++) {
+        codec.position = 0;
+        for (int i = 0; i < BENCH_RECORDS; i++) {
+            Sample& s = decoded[i];
+            AXDR_ENCODE_PARAMS params[6] = {
+                {&s.value, FIELD_VALUE}, {&s.status, FIELD_STATUS}, {&s.valid, FIELD_VALID},
+                {&s.scaler, FIELD_SCALER}, {&s.time, FIELD_TIME}, {&s.unit, FIELD_UNIT}};
+            errors |= axdr_decode_sequence_with_params(&codec, params, 6, decode_sample_field);
+        }
+    }
+    double cDecode = now_seconds() - start;
+
+    // C++ 模板
+    start = now_seconds();
+    for (size_t r = 0; r < rounds; r++) {
+        axdr_codec_attach(&codec, buffer, sizeof(buffer));
+        for (int i = 0; i < BENCH_RECORDS; i++) {
+            errors |= axdr::encode(codec, samples[i]);
+        }
+    }
+    double cppEncode = now_seconds() - start;
+
+    start = now_seconds();
+    for (size_t r = 0; r < rounds; r++) {
+        codec.position = 0;
+        for (int i = 0; i < BENCH_RECORDS; i++) {
+            errors |= axdr::decode(codec, decoded[i]);
+        }
+    }
+    double cppDecode = now_seconds() - start;
+
+    double records = (double)rounds * BENCH_RECORDS;
+    std::printf("C callbacks: encode %7.2f ns/record, decode %7.2f ns/record\n",
+                cEncode * 1e9 / records, cDecode * 1e9 / records);
+    std::printf("C++ fields:  encode %7.2f ns/record, decode %7.2f ns/record\n",
+                cppEncode * 1e9 / records, cppDecode * 1e9 / records);
+    std::printf("(errors %d, last value %d)\n", errors, decoded[BENCH_RECORDS - 1].value);
+    return 0;
+}
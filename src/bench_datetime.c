@@ -0,0 +1,87 @@
+#include "axdr_datetime.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+// 时间戳数组的性能测试：GeneralizedTime（gmtime / sscanf / timegm）与二进制 date-time 批量编解码对比
+// 用法: bench_datetime [每帧时间戳个数] [帧数]
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int main(int argc, char** argv) {
+    size_t count = argc > 1 ? strtoul(argv[1], NULL, 10) : 96;
+    size_t frames = argc > 2 ? strtoul(argv[2], NULL, 10) : 20000;
+
+    size_t size = 4 + count * 18;
+    uint8_t* buffer = (uint8_t*)malloc(size);
+    time_t* times = (time_t*)malloc(count * sizeof(time_t));
+    time_t* back = (time_t*)malloc(count * sizeof(time_t));
+    if (!buffer || !times || !back) {
+        return 1;
+    }
+    // 15 分钟间隔的负荷曲线
+    for (size_t i = 0; i < count; i++) {
+        times[i] = 1700000000 + (time_t)i * 900;
+    }
+
+    AXDR_CODEC codec;
+    int errors = 0;
+    long long sink = 0;
+
+    printf("Timestamp array benchmark, %zu timestamps x %zu frames\n", count, frames);
+
+    double start = now_seconds();
+    for (size_t f = 0; f < frames; f++) {
+        axdr_codec_attach(&codec, buffer, size);
+        errors |= axdr_encode_unsigned(&codec, (uint32_t)count, UINT32_MAX);
+        for (size_t i = 0; i < count; i++) {
+            errors |= axdr_encode_generalized_time(&codec, times[i]);
+        }
+        sink += (long long)codec.position;
+    }
+    double stringEncode = now_seconds() - start;
+
+    start = now_seconds();
+    for (size_t f = 0; f < frames; f++) {
+        uint32_t n = 0;
+        axdr_codec_attach(&codec, buffer, size);
+        errors |= axdr_decode_unsigned(&codec, &n, (uint32_t)count);
+        for (size_t i = 0; i < n; i++) {
+            errors |= axdr_decode_generalized_time(&codec, &back[i]);
+        }
+        sink += back[count - 1];
+    }
+    double stringDecode = now_seconds() - start;
+
+    start = now_seconds();
+    for (size_t f = 0; f < frames; f++) {
+        axdr_codec_attach(&codec, buffer, size);
+        errors |= axdr_encode_date_time_array(&codec, times, count, -60, 0);
+        sink += (long long)codec.position;
+    }
+    double binaryEncode = now_seconds() - start;
+
+    start = now_seconds();
+    for (size_t f = 0; f < frames; f++) {
+        size_t n;
+        axdr_codec_attach(&codec, buffer, size);
+        errors |= axdr_decode_date_time_array(&codec, back, NULL, &n, count);
+        sink += back[count - 1];
+    }
+    double binaryDecode = now_seconds() - start;
+
+    double values = (double)frames * count;
+    printf("GeneralizedTime encode: %8.2f ns/value\n", stringEncode * 1e9 / values);
+    printf("GeneralizedTime decode: %8.2f ns/value\n", stringDecode * 1e9 / values);
+    printf("date-time array encode: %8.2f ns/value\n", binaryEncode * 1e9 / values);
+    printf("date-time array decode: %8.2f ns/value\n", binaryDecode * 1e9 / values);
+    printf("(errors %d, sink %lld)\n", errors, sink);
+
+    free(back);
+    free(times);
+    free(buffer);
+    return 0;
+}
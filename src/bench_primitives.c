@@ -0,0 +1,70 @@
+#include "axdr.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+// 定长基本类型编解码的性能测试
+// 分别以 -DAXDR_INLINE_PRIMITIVES=ON/OFF 构建，对比内联与外部调用的开销
+// 用法: bench_primitives [迭代次数]
+
+#define BENCH_VALUES 1024
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int main(int argc, char** argv) {
+    size_t rounds = argc > 1 ? strtoul(argv[1], NULL, 10) : 20000;
+    static uint8_t buffer[BENCH_VALUES * 9];
+    int32_t values[BENCH_VALUES];
+    for (int i = 0; i < BENCH_VALUES; i++) {
+        values[i] = (int32_t)(i * 2654435761u);
+    }
+
+#ifdef AXDR_INLINE_PRIMITIVES
+    printf("Primitive benchmark (inline primitives), %zu x %d values\n", rounds, BENCH_VALUES);
+#else
+    printf("Primitive benchmark (out-of-line primitives), %zu x %d values\n", rounds, BENCH_VALUES);
+#endif
+
+    AXDR_CODEC codec;
+    axdr_codec_attach(&codec, buffer, sizeof(buffer));
+    int errors = 0;
+
+    // 编码：整数 + 无符号 + 布尔，约束为常量
+    double start = now_seconds();
+    for (size_t r = 0; r < rounds; r++) {
+        codec.position = 0;
+        for (int i = 0; i < BENCH_VALUES; i++) {
+            errors |= axdr_encode_integer(&codec, values[i], INT32_MIN, INT32_MAX);
+            errors |= axdr_encode_unsigned(&codec, (uint32_t)i, 65535);
+            errors |= axdr_encode_boolean(&codec, (values[i] & 1) != 0);
+        }
+    }
+    double encodeTime = now_seconds() - start;
+
+    // 解码
+    int64_t checksum = 0;
+    start = now_seconds();
+    for (size_t r = 0; r < rounds; r++) {
+        codec.position = 0;
+        for (int i = 0; i < BENCH_VALUES; i++) {
+            int32_t value = 0;
+            uint32_t index = 0;
+            bool flag = false;
+            errors |= axdr_decode_integer(&codec, &value, INT32_MIN, INT32_MAX);
+            errors |= axdr_decode_unsigned(&codec, &index, 65535);
+            errors |= axdr_decode_boolean(&codec, &flag);
+            checksum += value + (int64_t)index + flag;
+        }
+    }
+    double decodeTime = now_seconds() - start;
+
+    double ops = (double)rounds * BENCH_VALUES * 3;
+    printf("encode: %8.2f ns/field\n", encodeTime * 1e9 / ops);
+    printf("decode: %8.2f ns/field\n", decodeTime * 1e9 / ops);
+    printf("(errors %d, checksum %lld)\n", errors, (long long)checksum);
+    return 0;
+}
@@ -0,0 +1,136 @@
+#include "axdr.h"
+#include "axdr_ring.h"
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// 无锁环形队列与互斥锁队列的吞吐量对比
+// 用法: bench_ring [元素个数] [批量大小]
+
+#define QUEUE_CAPACITY 1024
+
+// 对照组：互斥锁 + 条件变量保护的循环队列
+typedef struct {
+    pthread_mutex_t lock;
+    pthread_cond_t  notEmpty;
+    pthread_cond_t  notFull;
+    AXDR_CODEC      items[QUEUE_CAPACITY];
+    size_t          head;
+    size_t          count;
+} MutexQueue;
+
+typedef struct {
+    AXDR_RING*  ring;
+    MutexQueue* queue;
+    size_t      items;
+    size_t      batch;
+} BenchArgs;
+
+static uint8_t frame[64];
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void* ring_producer(void* arg) {
+    BenchArgs* args = (BenchArgs*)arg;
+    AXDR_CODEC views[256];
+    for (size_t i = 0; i < args->batch; i++) {
+        axdr_codec_attach(&views[i], frame, sizeof(frame));
+    }
+    for (size_t sent = 0; sent < args->items;) {
+        size_t n = args->items - sent < args->batch ? args->items - sent : args->batch;
+        sent += axdr_ring_enqueue_wait(args->ring, views, n, 256, -1);
+    }
+    return NULL;
+}
+
+static void* queue_producer(void* arg) {
+    BenchArgs* args = (BenchArgs*)arg;
+    MutexQueue* q = args->queue;
+    AXDR_CODEC view;
+    axdr_codec_attach(&view, frame, sizeof(frame));
+    for (size_t i = 0; i < args->items; i++) {
+        pthread_mutex_lock(&q->lock);
+        while (q->count == QUEUE_CAPACITY) {
+            pthread_cond_wait(&q->notFull, &q->lock);
+        }
+        q->items[(q->head + q->count) % QUEUE_CAPACITY] = view;
+        q->count++;
+        pthread_cond_signal(&q->notEmpty);
+        pthread_mutex_unlock(&q->lock);
+    }
+    return NULL;
+}
+
+static double bench_ring(int mode, size_t items, size_t batch) {
+    BenchArgs args = {axdr_ring_create(QUEUE_CAPACITY, sizeof(AXDR_CODEC), mode), NULL, items, batch};
+    pthread_t producer;
+    double start = now_seconds();
+    pthread_create(&producer, NULL, ring_producer, &args);
+
+    AXDR_CODEC views[256];
+    size_t checksum = 0;
+    for (size_t received = 0; received < items;) {
+        size_t n = axdr_ring_dequeue_wait(args.ring, views, batch, 256, -1);
+        for (size_t i = 0; i < n; i++) {
+            checksum += views[i].size;
+        }
+        received += n;
+    }
+    pthread_join(producer, NULL);
+    double elapsed = now_seconds() - start;
+    axdr_ring_destroy(args.ring);
+    return checksum == items * sizeof(frame) ? items / elapsed : 0;
+}
+
+static double bench_mutex(size_t items) {
+    MutexQueue* q = (MutexQueue*)calloc(1, sizeof(MutexQueue));
+    pthread_mutex_init(&q->lock, NULL);
+    pthread_cond_init(&q->notEmpty, NULL);
+    pthread_cond_init(&q->notFull, NULL);
+    BenchArgs args = {NULL, q, items, 1};
+    pthread_t producer;
+    double start = now_seconds();
+    pthread_create(&producer, NULL, queue_producer, &args);
+
+    size_t checksum = 0;
+    for (size_t i = 0; i < items; i++) {
+        pthread_mutex_lock(&q->lock);
+        while (q->count == 0) {
+            pthread_cond_wait(&q->notEmpty, &q->lock);
+        }
+        checksum += q->items[q->head].size;
+        q->head = (q->head + 1) % QUEUE_CAPACITY;
+        q->count--;
+        pthread_cond_signal(&q->notFull);
+        pthread_mutex_unlock(&q->lock);
+    }
+    pthread_join(producer, NULL);
+    double elapsed = now_seconds() - start;
+    pthread_mutex_destroy(&q->lock);
+    pthread_cond_destroy(&q->notEmpty);
+    pthread_cond_destroy(&q->notFull);
+    free(q);
+    return checksum == items * sizeof(frame) ? items / elapsed : 0;
+}
+
+int main(int argc, char** argv) {
+    size_t items = argc > 1 ? strtoul(argv[1], NULL, 10) : 2000000;
+    size_t batch = argc > 2 ? strtoul(argv[2], NULL, 10) : 32;
+    if (batch == 0 || batch > 256) {
+        batch = 32;
+    }
+
+    printf("Ring benchmark: %zu AXDR_CODEC views, batch %zu\n", items, batch);
+    printf("mutex queue      : %10.2f Mitems/s\n", bench_mutex(items) / 1e6);
+    printf("SPSC ring (1)    : %10.2f Mitems/s\n", bench_ring(AXDR_RING_SPSC, items, 1) / 1e6);
+    printf("SPSC ring (batch): %10.2f Mitems/s\n", bench_ring(AXDR_RING_SPSC, items, batch) / 1e6);
+    printf("MPMC ring (1)    : %10.2f Mitems/s\n", bench_ring(AXDR_RING_MPMC, items, 1) / 1e6);
+    printf("MPMC ring (batch): %10.2f Mitems/s\n", bench_ring(AXDR_RING_MPMC, items, batch) / 1e6);
+    return 0;
+}
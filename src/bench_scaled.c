@@ -0,0 +1,83 @@
+#include "axdr_scaled.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+// 寄存器值批量解码的性能测试：axdr_decode_sequence_of 解出整数后第二遍换算为 double，
+// 与 axdr_decode_scaled 一遍完成解码与换算对比
+// 用法: bench_scaled [每帧行数] [帧数]
+
+#define COLUMNS  4
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// 一行：COLUMNS 个 INTEGER
+static int decode_row(AXDR_CODEC* codec, void* field) {
+    int32_t* row = (int32_t*)field;
+    int result = AXDR_SUCCESS;
+    for (int c = 0; c < COLUMNS && result == AXDR_SUCCESS; c++) {
+        result = axdr_decode_integer(codec, &row[c], INT32_MIN, INT32_MAX);
+    }
+    return result;
+}
+
+int main(int argc, char** argv) {
+    size_t rows = argc > 1 ? strtoul(argv[1], NULL, 10) : 96;
+    size_t frames = argc > 2 ? strtoul(argv[2], NULL, 10) : 50000;
+    size_t count = rows * COLUMNS;
+
+    size_t size = 4 + count * 4;
+    uint8_t* buffer = (uint8_t*)malloc(size);
+    int32_t* raw = (int32_t*)malloc(count * sizeof(int32_t));
+    double* values = (double*)malloc(count * sizeof(double));
+    if (!buffer || !raw || !values) {
+        return 1;
+    }
+
+    // 负荷曲线：有功电能 (Wh, -3 -> kWh)、无功电能、电压 (-1)、电流 (-2)
+    const AXDR_SCALED_COLUMN columns[COLUMNS] = {{-3, false}, {-3, false}, {-1, false}, {-2, false}};
+    double factors[COLUMNS] = {1e-3, 1e-3, 1e-1, 1e-2};
+    AXDR_CODEC codec;
+    axdr_codec_attach(&codec, buffer, size);
+    int errors = axdr_encode_unsigned(&codec, (uint32_t)rows, UINT32_MAX);
+    for (size_t i = 0; i < count; i++) {
+        errors |= axdr_encode_integer(&codec, (int32_t)(i * 7919 % 250000), INT32_MIN, INT32_MAX);
+    }
+
+    double sink = 0;
+    printf("Scaled decode benchmark, %zu rows x %d columns x %zu frames\n", rows, COLUMNS, frames);
+
+    double start = now_seconds();
+    for (size_t f = 0; f < frames; f++) {
+        AXDR_SEQUENCE_OF sequence = {raw, COLUMNS * sizeof(int32_t), 0, rows};
+        axdr_codec_attach(&codec, buffer, size);
+        errors |= axdr_decode_sequence_of(&codec, &sequence, decode_row);
+        for (size_t i = 0; i < sequence.count * COLUMNS; i++) {
+            values[i] = raw[i] * factors[i % COLUMNS];
+        }
+        sink += values[count - 1];
+    }
+    double twoPassTime = now_seconds() - start;
+
+    start = now_seconds();
+    for (size_t f = 0; f < frames; f++) {
+        size_t decoded;
+        axdr_codec_attach(&codec, buffer, size);
+        errors |= axdr_decode_scaled(&codec, values, &decoded, rows, columns, COLUMNS);
+        sink += values[count - 1];
+    }
+    double fusedTime = now_seconds() - start;
+
+    double total = (double)frames * count;
+    printf("sequence_of + scale pass: %8.3f ns/value\n", twoPassTime * 1e9 / total);
+    printf("decode_scaled:            %8.3f ns/value\n", fusedTime * 1e9 / total);
+    printf("(errors %d, sink %g)\n", errors, sink);
+
+    free(values);
+    free(raw);
+    free(buffer);
+    return 0;
+}
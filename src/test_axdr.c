@@ -181,6 +181,68 @@ void test_visible_string() {
     axdr_codec_cleanup(codec);
 }
 
+void test_visible_string_validation() {
+    printf("\nTesting VisibleString Validation...\n");
+
+    uint8_t buffer[256];
+    AXDR_CODEC* codec = axdr_codec_init(buffer, sizeof(buffer));
+    char text[101];
+    char decoded[101];
+    int failed = 0;
+
+    // 不同位置的非法字符：编码报告输入中的偏移，解码报告缓冲区中的偏移
+    for (size_t bad = 0; bad < 100; bad += 7) {
+        for (size_t i = 0; i < 100; i++) {
+            text[i] = (char)(0x20 + i % 95);
+        }
+        text[100] = '\0';
+
+        codec->position = 0;
+        if (axdr_encode_visible_string(codec, text, 100) != AXDR_SUCCESS) {
+            failed = 1;
+        }
+        buffer[4 + bad] = 0x7F;
+        codec->position = 0;
+        int result = axdr_decode_visible_string(codec, decoded, 100);
+        if (result != AXDR_ERROR_INVALID_VALUE || codec->errorOffset != 4 + bad || codec->position != 0) {
+            failed = 1;
+        }
+
+        text[bad] = (char)0xC3;
+        codec->position = 0;
+        result = axdr_encode_visible_string(codec, text, 100);
+        if (result != AXDR_ERROR_INVALID_VALUE || codec->errorOffset != bad || codec->position != 0) {
+            failed = 1;
+        }
+    }
+
+    // 长度超过约束时不写入目标
+    for (size_t i = 0; i < 100; i++) {
+        text[i] = 'a';
+    }
+    text[100] = '\0';
+    codec->position = 0;
+    int result = axdr_encode_visible_string(codec, text, 100);
+    codec->position = 0;
+    if (result != AXDR_SUCCESS || axdr_decode_visible_string(codec, decoded, 20) != AXDR_ERROR_CONSTRAINT) {
+        failed = 1;
+    }
+    codec->position = 0;
+    if (axdr_encode_visible_string(codec, text, 99) != AXDR_ERROR_CONSTRAINT) {
+        failed = 1;
+    }
+
+    // 缓冲区不足
+    AXDR_CODEC* small = axdr_codec_init(buffer, 50);
+    if (axdr_encode_visible_string(small, text, 100) != AXDR_ERROR_BUFFER_OVERFLOW || small->position != 0) {
+        failed = 1;
+    }
+    axdr_codec_cleanup(small);
+
+    printf("VisibleString validation test %s\n", failed ? "failed" : "passed");
+    axdr_codec_cleanup(codec);
+}
+
 void test_generalized_time() {
     printf("\nTesting GeneralizedTime Encoding/Decoding...\n");
     
@@ -244,6 +306,7 @@ int main() {
     test_enum();
     test_bit_string();
     test_visible_string();
+    test_visible_string_validation();
     test_generalized_time();
     test_null();
     test_sequence();
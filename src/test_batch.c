@@ -0,0 +1,79 @@
+#include "axdr_batch.h"
+#include <stdio.h>
+#include <string.h>
+
+#define BATCH_MESSAGES 100
+
+void test_batch() {
+    printf("\nTesting Batch Framing...\n");
+
+    static uint8_t buffer[8192];
+    AXDR_CODEC codec;
+    axdr_codec_attach(&codec, buffer, sizeof(buffer));
+
+    // 交替使用原位编码和拷贝已编码消息
+    AXDR_BATCH_WRITER writer;
+    int res = axdr_batch_begin(&writer, &codec);
+    for (int i = 0; i < BATCH_MESSAGES; i++) {
+        if (i % 2 == 0) {
+            res |= axdr_batch_message_begin(&writer);
+            res |= axdr_encode_unsigned(&codec, (uint32_t)i, UINT32_MAX);
+            for (int k = 0; k < i % 5; k++) {
+                res |= axdr_encode_integer(&codec, -k, INT32_MIN, INT32_MAX);
+            }
+            res |= axdr_batch_message_end(&writer);
+        } else {
+            uint8_t message[8];
+            AXDR_CODEC encoded;
+            axdr_codec_attach(&encoded, message, sizeof(message));
+            res |= axdr_encode_unsigned(&encoded, (uint32_t)i, UINT32_MAX);
+            res |= axdr_batch_add(&writer, message, encoded.position);
+        }
+    }
+    res |= axdr_batch_end(&writer);
+    size_t batchLength = codec.position;
+
+    // 拆分并逐条解码
+    AXDR_FRAME_DESC frames[BATCH_MESSAGES];
+    size_t count = 0;
+    AXDR_CODEC input;
+    axdr_codec_attach(&input, buffer, batchLength);
+    res |= axdr_batch_split(&input, frames, BATCH_MESSAGES, &count);
+    int ok = res == AXDR_SUCCESS && count == BATCH_MESSAGES && input.position == batchLength;
+    for (size_t i = 0; ok && i < count; i++) {
+        AXDR_CODEC frame;
+        uint32_t id;
+        axdr_batch_frame_codec(&input, &frames[i], &frame);
+        ok = axdr_decode_unsigned(&frame, &id, UINT32_MAX) == AXDR_SUCCESS && id == i &&
+             frames[i].length == 4 + (i % 2 == 0 ? 4 * (i % 5) : 0);
+    }
+    printf("Batch write and split: %s\n", ok ? "pass" : "fail");
+
+    // 描述数组不够时报告所需个数
+    axdr_codec_attach(&input, buffer, batchLength);
+    res = axdr_batch_split(&input, frames, 10, &count);
+    printf("Batch split capacity: %s\n",
+           (res == AXDR_ERROR_CONSTRAINT && count == BATCH_MESSAGES && input.position == 0) ? "pass" : "fail");
+
+    // 截断的批次
+    axdr_codec_attach(&input, buffer, batchLength - 1);
+    res = axdr_batch_split(&input, frames, BATCH_MESSAGES, &count);
+    printf("Batch truncated: %s\n", res == AXDR_ERROR_BUFFER_OVERFLOW ? "pass" : "fail");
+
+    // 消息长度越过批次边界
+    buffer[AXDR_BATCH_HEADER_SIZE + 3] = 0xFF;
+    axdr_codec_attach(&input, buffer, batchLength);
+    res = axdr_batch_split(&input, frames, BATCH_MESSAGES, &count);
+    printf("Batch corrupt length: %s\n", res == AXDR_ERROR_INVALID_LENGTH ? "pass" : "fail");
+
+    // 魔数错误
+    buffer[0] = 'X';
+    axdr_codec_attach(&input, buffer, batchLength);
+    res = axdr_batch_split(&input, frames, BATCH_MESSAGES, &count);
+    printf("Batch bad magic: %s\n", res == AXDR_ERROR_INVALID_VALUE ? "pass" : "fail");
+}
+
+int main() {
+    test_batch();
+    return 0;
+}
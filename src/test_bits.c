@@ -0,0 +1,88 @@
+#include "axdr_bits.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_FLAGS 300
+
+// 逐位打包的参考实现
+static void reference_pack(const bool* values, size_t count, uint8_t* bits) {
+    memset(bits, 0, (count + 7) / 8);
+    for (size_t i = 0; i < count; i++) {
+        if (values[i]) {
+            bits[i / 8] |= (uint8_t)(0x80 >> (i % 8));
+        }
+    }
+}
+
+void test_bits() {
+    printf("\nTesting Packed Boolean Array...\n");
+
+    bool values[MAX_FLAGS];
+    bool decoded[MAX_FLAGS];
+    uint8_t reference[MAX_FLAGS / 8 + 1];
+    uint8_t buffer[64];
+    uint8_t expected[64];
+    srand(35);
+
+    // 各种长度下与 BIT STRING 编码逐字节一致，且能还原
+    int same = 1;
+    int roundtrip = 1;
+    int queries = 1;
+    for (size_t count = 0; count <= MAX_FLAGS; count++) {
+        size_t ones = 0;
+        for (size_t i = 0; i < count; i++) {
+            values[i] = (rand() & 3) == 0;
+            ones += values[i];
+        }
+        reference_pack(values, count, reference);
+
+        AXDR_CODEC codec;
+        AXDR_CODEC ref;
+        axdr_codec_attach(&codec, buffer, sizeof(buffer));
+        axdr_codec_attach(&ref, expected, sizeof(expected));
+        int res = axdr_encode_boolean_array(&codec, values, count);
+        res |= axdr_encode_bit_string(&ref, reference, count);
+        same &= res == AXDR_SUCCESS && codec.position == ref.position &&
+                memcmp(buffer, expected, codec.position) == 0;
+
+        size_t decodedCount = 0;
+        axdr_codec_attach(&codec, buffer, ref.position);
+        res = axdr_decode_boolean_array(&codec, decoded, &decodedCount, MAX_FLAGS);
+        roundtrip &= res == AXDR_SUCCESS && decodedCount == count &&
+                     memcmp(values, decoded, count) == 0;
+
+        AXDR_BITMAP bitmap;
+        axdr_codec_attach(&codec, buffer, ref.position);
+        res = axdr_decode_bitmap(&codec, &bitmap, MAX_FLAGS);
+        queries &= res == AXDR_SUCCESS && axdr_bitmap_popcount(&bitmap) == ones &&
+                   axdr_bitmap_any(&bitmap) == (ones > 0) && axdr_bitmap_all(&bitmap) == (ones == count);
+        for (size_t i = 0; i < count; i++) {
+            queries &= axdr_bitmap_get(&bitmap, i) == values[i];
+        }
+    }
+    printf("Boolean array matches bit string: %s\n", same ? "pass" : "fail");
+    printf("Boolean array roundtrip: %s\n", roundtrip ? "pass" : "fail");
+    printf("Bitmap queries: %s\n", queries ? "pass" : "fail");
+
+    // 末字节中的填充位不参与统计
+    const uint8_t padded[] = {0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF};
+    AXDR_CODEC codec;
+    AXDR_BITMAP bitmap;
+    axdr_codec_attach(&codec, (uint8_t*)padded, sizeof(padded));
+    int res = axdr_decode_bitmap(&codec, &bitmap, MAX_FLAGS);
+    printf("Bitmap padding ignored: %s\n",
+           (res == AXDR_SUCCESS && axdr_bitmap_popcount(&bitmap) == 11 && axdr_bitmap_all(&bitmap)) ? "pass" : "fail");
+
+    // 超过容量
+    size_t decodedCount;
+    axdr_codec_attach(&codec, (uint8_t*)padded, sizeof(padded));
+    res = axdr_decode_boolean_array(&codec, decoded, &decodedCount, 8);
+    printf("Boolean array capacity: %s\n",
+           (res == AXDR_ERROR_CONSTRAINT && codec.position == 0) ? "pass" : "fail");
+}
+
+int main() {
+    test_bits();
+    return 0;
+}
@@ -0,0 +1,169 @@
+#include "axdr.h"
+#include "axdr_walk.h"
+#include <stdio.h>
+#include <string.h>
+
+static int decodedElements;
+
+static int decode_element(AXDR_CODEC* codec, void* field) {
+    decodedElements++;
+    return axdr_decode_integer(codec, (int32_t*)field, INT32_MIN, INT32_MAX);
+}
+
+// 递归的 SEQUENCE OF：每个元素又是一个 SEQUENCE OF
+static int decode_nested(AXDR_CODEC* codec, void* field) {
+    int32_t inner[4];
+    AXDR_SEQUENCE_OF sequence = {inner, sizeof(int32_t), 0, 4};
+    (void)field;
+    uint32_t kind;
+    int result = axdr_decode_unsigned(codec, &kind, 1);
+    if (result != AXDR_SUCCESS) {
+        return result;
+    }
+    return kind ? axdr_decode_sequence_of(codec, &sequence, decode_nested)
+                : axdr_decode_sequence_of(codec, &sequence, decode_element);
+}
+
+static int decode_field(AXDR_CODEC* codec, void* field) {
+    return axdr_decode_integer(codec, (int32_t*)field, INT32_MIN, INT32_MAX);
+}
+
+void test_budget() {
+    printf("\nTesting Decode Budgets...\n");
+
+    uint8_t buffer[1024];
+    AXDR_CODEC codec;
+    AXDR_DECODE_BUDGET budget;
+    const uint8_t payload[32] = {1, 2, 3, 4, 5, 6, 7, 8};
+
+    // 按容量解码：超出容量时不拷贝
+    axdr_codec_attach(&codec, buffer, sizeof(buffer));
+    axdr_encode_octet_string(&codec, payload, sizeof(payload));
+    axdr_encode_bit_string(&codec, payload, 100);
+    size_t encoded = codec.position;
+    uint8_t small[16];
+    memset(small, 0xAA, sizeof(small));
+    size_t length = 0;
+    axdr_codec_attach(&codec, buffer, encoded);
+    int res = axdr_decode_octet_string_bounded(&codec, small, sizeof(small), &length);
+    int ok = res == AXDR_ERROR_CONSTRAINT && codec.position == 0 && small[0] == 0xAA;
+    uint8_t large[32];
+    res = axdr_decode_octet_string_bounded(&codec, large, sizeof(large), &length);
+    ok &= res == AXDR_SUCCESS && length == 32 && large[7] == 8;
+    size_t bitStart = codec.position;
+    res = axdr_decode_bit_string_bounded(&codec, small, 96, &length);
+    ok &= res == AXDR_ERROR_CONSTRAINT && codec.position == bitStart && small[0] == 0xAA;
+    res = axdr_decode_bit_string_bounded(&codec, small, 128, &length);
+    ok &= res == AXDR_SUCCESS && length == 100 && codec.position == encoded;
+    printf("Budget bounded strings: %s\n", ok ? "pass" : "fail");
+
+    // 输出字节预算
+    axdr_codec_attach(&codec, buffer, sizeof(buffer));
+    for (int i = 0; i < 4; i++) {
+        axdr_encode_octet_string(&codec, payload, sizeof(payload));
+    }
+    encoded = codec.position;
+    axdr_budget_init(&budget, 100, 0, 0, 0);
+    axdr_codec_attach(&codec, buffer, encoded);
+    codec.budget = &budget;
+    res = AXDR_SUCCESS;
+    int decoded = 0;
+    while (res == AXDR_SUCCESS && decoded < 4) {
+        res = axdr_decode_octet_string(&codec, large, &length);
+        decoded += res == AXDR_SUCCESS;
+    }
+    printf("Budget output bytes: %s\n",
+           (res == AXDR_ERROR_BUDGET && decoded == 3 && budget.outputBytes == 96 &&
+            codec.error == AXDR_ERROR_BUDGET && codec.errorOffset == 3 * 36 + 4) ? "pass" : "fail");
+
+    // 元素预算：伪造的元素个数在解码任何元素之前被拒绝
+    int32_t elements[1000];
+    AXDR_SEQUENCE_OF sequence = {elements, sizeof(int32_t), 0, 1000};
+    axdr_codec_attach(&codec, buffer, sizeof(buffer));
+    axdr_encode_unsigned(&codec, 1000, 1000);
+    axdr_budget_init(&budget, 0, 256, 0, 0);
+    axdr_codec_attach(&codec, buffer, sizeof(buffer));
+    codec.budget = &budget;
+    decodedElements = 0;
+    res = axdr_decode_sequence_of(&codec, &sequence, decode_element);
+    printf("Budget elements: %s\n",
+           (res == AXDR_ERROR_BUDGET && decodedElements == 0 && budget.depth == 0) ? "pass" : "fail");
+
+    // 嵌套深度预算
+    axdr_codec_attach(&codec, buffer, sizeof(buffer));
+    for (int level = 0; level < 10; level++) {
+        axdr_encode_unsigned(&codec, 1, 4);     // 一个元素
+        axdr_encode_unsigned(&codec, 1, 1);     // 元素仍是 SEQUENCE OF
+    }
+    axdr_encode_unsigned(&codec, 1, 4);
+    axdr_encode_unsigned(&codec, 0, 1);
+    axdr_encode_unsigned(&codec, 0, 4);
+    encoded = codec.position;
+    int32_t outer;
+    AXDR_SEQUENCE_OF root = {&outer, sizeof(int32_t), 0, 4};
+    axdr_budget_init(&budget, 0, 0, 8, 0);
+    axdr_codec_attach(&codec, buffer, encoded);
+    codec.budget = &budget;
+    res = axdr_decode_sequence_of(&codec, &root, decode_nested);
+    ok = res == AXDR_ERROR_BUDGET && budget.depth == 0;
+    axdr_budget_init(&budget, 0, 0, 16, 0);
+    axdr_codec_attach(&codec, buffer, encoded);
+    codec.budget = &budget;
+    res = axdr_decode_sequence_of(&codec, &root, decode_nested);
+    ok &= res == AXDR_SUCCESS && codec.position == encoded && budget.depth == 0;
+    printf("Budget nesting depth: %s\n", ok ? "pass" : "fail");
+
+    // 工作量预算
+    int32_t values[8];
+    void* fields[8];
+    AXDR_DECODE_FIELD decoders[8];
+    axdr_codec_attach(&codec, buffer, sizeof(buffer));
+    for (int i = 0; i < 8; i++) {
+        axdr_encode_integer(&codec, i, INT32_MIN, INT32_MAX);
+        fields[i] = &values[i];
+        decoders[i] = decode_field;
+    }
+    encoded = codec.position;
+    axdr_budget_init(&budget, 0, 0, 0, 20);
+    ok = 1;
+    for (int round = 0; round < 3; round++) {
+        axdr_codec_attach(&codec, buffer, encoded);
+        codec.budget = &budget;
+        res = axdr_decode_sequence(&codec, fields, decoders, 8);
+        ok &= round < 2 ? res == AXDR_SUCCESS : res == AXDR_ERROR_BUDGET;
+    }
+    axdr_budget_reset(&budget);
+    axdr_codec_attach(&codec, buffer, encoded);
+    codec.budget = &budget;
+    ok &= axdr_decode_sequence(&codec, fields, decoders, 8) == AXDR_SUCCESS && budget.work == 8;
+    printf("Budget work units: %s\n", ok ? "pass" : "fail");
+
+    // 模式遍历同样受预算限制，出错后深度恢复
+    static const AXDR_SCHEMA item[] = {{.type = AXDR_TYPE_OCTET_STRING, .maxLength = 64}};
+    static const AXDR_SCHEMA list = {.type = AXDR_TYPE_SEQUENCE_OF, .maxLength = 100, .children = item, .childCount = 1};
+    axdr_codec_attach(&codec, buffer, sizeof(buffer));
+    axdr_encode_unsigned(&codec, 20, 100);
+    for (int i = 0; i < 20; i++) {
+        axdr_encode_octet_string(&codec, payload, sizeof(payload));
+    }
+    encoded = codec.position;
+    AXDR_WALK_FRAME frames[AXDR_WALK_DEFAULT_DEPTH];
+    AXDR_WALKER walker;
+    axdr_walker_init(&walker, frames, AXDR_WALK_DEFAULT_DEPTH);
+    axdr_budget_init(&budget, 0, 10, 0, 0);
+    axdr_codec_attach(&codec, buffer, encoded);
+    codec.budget = &budget;
+    res = axdr_walk_decode(&walker, &codec, &list, NULL);
+    ok = res == AXDR_ERROR_BUDGET && budget.depth == 0;
+    axdr_budget_init(&budget, 0, 20, 1, 20);
+    axdr_codec_attach(&codec, buffer, encoded);
+    codec.budget = &budget;
+    res = axdr_walk_decode(&walker, &codec, &list, NULL);
+    ok &= res == AXDR_SUCCESS && budget.depth == 0 && budget.work == 20;
+    printf("Budget schema walk: %s\n", ok ? "pass" : "fail");
+}
+
+int main() {
+    test_budget();
+    return 0;
+}
@@ -0,0 +1,90 @@
+#include "axdr_cache.h"
+#include <stdio.h>
+#include <string.h>
+
+typedef struct {
+    int32_t meterClass;
+    int32_t attribute;
+    bool    selective;
+} GetRequest;
+
+static int encode_request_field(AXDR_CODEC* codec, const void* field, int field_type) {
+    switch (field_type) {
+        case 0: // integer
+            return axdr_encode_integer(codec, *(const int32_t*)field, INT32_MIN, INT32_MAX);
+        case 1: // boolean
+            return axdr_encode_boolean(codec, *(const bool*)field);
+        default:
+            return AXDR_ERROR_INVALID_TYPE;
+    }
+}
+
+static int encode_request(AXDR_ENCODE_CACHE* cache, AXDR_CODEC* codec, const GetRequest* request) {
+    AXDR_ENCODE_PARAMS params[] = {
+        {&request->meterClass, 0},
+        {&request->attribute, 0},
+        {&request->selective, 1},
+    };
+    return axdr_encode_sequence_with_params_cached(cache, codec, 1, request, sizeof(*request),
+                                                   params, 3, encode_request_field);
+}
+
+void test_encode_cache() {
+    printf("\nTesting Encode Cache...\n");
+
+    AXDR_ENCODE_CACHE* cache = axdr_encode_cache_create(2, 8, 64);
+    uint8_t first[64], second[64];
+    AXDR_CODEC a, b;
+    axdr_codec_attach(&a, first, sizeof(first));
+    axdr_codec_attach(&b, second, sizeof(second));
+
+    GetRequest request;
+    memset(&request, 0, sizeof(request));
+    request.meterClass = 3;
+    request.attribute = 2;
+    request.selective = true;
+
+    int res = encode_request(cache, &a, &request);
+    res |= encode_request(cache, &b, &request);
+    AXDR_ENCODE_CACHE_STATS stats;
+    axdr_encode_cache_stats(cache, &stats);
+    printf("Encode cache hit: %s\n",
+           (res == AXDR_SUCCESS && a.position == 9 && b.position == 9 &&
+            memcmp(first, second, 9) == 0 && stats.hits == 1 && stats.misses == 1) ? "pass" : "fail");
+
+    // 命中时缓冲区不足
+    AXDR_CODEC small;
+    axdr_codec_attach(&small, second, 4);
+    printf("Encode cache overflow: %s\n",
+           encode_request(cache, &small, &request) == AXDR_ERROR_BUFFER_OVERFLOW ? "pass" : "fail");
+
+    // 超出容量后按 CLOCK 淘汰，结果仍然正确
+    int ok = 1;
+    for (int32_t i = 0; ok && i < 100; i++) {
+        request.attribute = i % 40;
+        a.position = 0;
+        b.position = 0;
+        ok = encode_request(cache, &a, &request) == AXDR_SUCCESS &&
+             axdr_encode_sequence_with_params(&b, (AXDR_ENCODE_PARAMS[]){
+                 {&request.meterClass, 0}, {&request.attribute, 0}, {&request.selective, 1}},
+                 3, encode_request_field) == AXDR_SUCCESS &&
+             a.position == b.position && memcmp(first, second, a.position) == 0;
+    }
+    axdr_encode_cache_stats(cache, &stats);
+    printf("Encode cache eviction: %s\n", (ok && stats.evictions > 0) ? "pass" : "fail");
+
+    // 超过单项上限的结果不缓存
+    AXDR_ENCODE_CACHE* tiny = axdr_encode_cache_create(1, 4, 8);
+    a.position = 0;
+    res = encode_request(tiny, &a, &request);
+    axdr_encode_cache_stats(tiny, &stats);
+    printf("Encode cache bypass: %s\n", (res == AXDR_SUCCESS && stats.bypasses == 1 && stats.inserts == 0) ? "pass" : "fail");
+
+    axdr_encode_cache_destroy(tiny);
+    axdr_encode_cache_destroy(cache);
+}
+
+int main() {
+    test_encode_cache();
+    return 0;
+}
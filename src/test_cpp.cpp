@@ -0,0 +1,128 @@
+#include "axdr.hpp"
+#include <cstdio>
+#include <cstring>
+
+// C++ 前端：与 C 接口逐字节一致、零拷贝视图、约束检查
+
+enum class Phase { L1, L2, L3 };
+
+struct Quality {
+    bool     valid;
+    uint32_t flags;
+
+    static constexpr auto axdr_fields() {
+        return axdr::fields(axdr::field<&Quality::valid, axdr::boolean>{},
+                            axdr::field<&Quality::flags, axdr::unsigned_integer<0xFFFF>>{});
+    }
+};
+
+struct Reading {
+    int32_t                   value;
+    Phase                     phase;
+    std::string_view          meter;
+    axdr::span<const uint8_t> raw;
+    std::vector<int32_t>      samples;
+    Quality                   quality;
+
+    static constexpr auto axdr_fields() {
+        return axdr::fields(
+            axdr::field<&Reading::value, axdr::integer<-1000000, 1000000>>{},
+            axdr::field<&Reading::phase, axdr::enumerated<3>>{},
+            axdr::field<&Reading::meter, axdr::visible_string<16>>{},
+            axdr::field<&Reading::raw, axdr::octet_string<8>>{},
+            axdr::field<&Reading::samples, axdr::sequence_of<32, axdr::integer<-100, 100>>>{},
+            axdr::field<&Reading::quality, axdr::sequence<Quality>>{});
+    }
+};
+
+struct Sample {
+    float  power;
+    double energy;
+
+    static constexpr auto axdr_fields() {
+        return axdr::fields(axdr::field<&Sample::power, axdr::float32>{},
+                            axdr::field<&Sample::energy, axdr::float64>{});
+    }
+};
+
+static size_t encode_reference(uint8_t* buffer, size_t size) {
+    const uint8_t raw[3] = {0xDE, 0xAD, 0x01};
+    AXDR_CODEC codec;
+    axdr_codec_attach(&codec, buffer, size);
+    int res = axdr_encode_integer(&codec, -4200, -1000000, 1000000);
+    res |= axdr_encode_enum(&codec, 2, 3);
+    res |= axdr_encode_visible_string(&codec, "MTR-0001", 16);
+    res |= axdr_encode_octet_string(&codec, raw, sizeof(raw));
+    res |= axdr_encode_unsigned(&codec, 4, 32);
+    for (int i = 0; i < 4; i++) {
+        res |= axdr_encode_integer(&codec, i * 10 - 20, -100, 100);
+    }
+    res |= axdr_encode_boolean(&codec, true);
+    res |= axdr_encode_unsigned(&codec, 0x1234, 0xFFFF);
+    return res == AXDR_SUCCESS ? codec.position : 0;
+}
+
+void test_cpp() {
+    std::printf("\nTesting C++ Front-end...\n");
+
+    const uint8_t raw[3] = {0xDE, 0xAD, 0x01};
+    Reading reading{-4200, Phase::L3, "MTR-0001", axdr::span<const uint8_t>(raw, 3),
+                    {-20, -10, 0, 10}, {true, 0x1234}};
+
+    uint8_t buffer[128];
+    uint8_t expected[128];
+    size_t expectedLength = encode_reference(expected, sizeof(expected));
+
+    AXDR_CODEC codec;
+    axdr_codec_attach(&codec, buffer, sizeof(buffer));
+    int res = axdr::encode(codec, reading);
+    std::printf("C++ encode matches C: %s\n",
+                (res == AXDR_SUCCESS && codec.position == expectedLength &&
+                 std::memcmp(buffer, expected, expectedLength) == 0) ? "pass" : "fail");
+
+    Reading decoded{};
+    axdr_codec_attach(&codec, buffer, expectedLength);
+    res = axdr::decode(codec, decoded);
+    bool views = decoded.meter.data() == reinterpret_cast<const char*>(buffer) + 12 &&
+                 decoded.raw.data() >= buffer && decoded.raw.data() < buffer + expectedLength;
+    std::printf("C++ decode: %s\n",
+                (res == AXDR_SUCCESS && codec.position == expectedLength && decoded.value == -4200 &&
+                 decoded.phase == Phase::L3 && decoded.meter == "MTR-0001" && decoded.raw.size() == 3 &&
+                 std::memcmp(decoded.raw.data(), raw, 3) == 0 && decoded.samples == reading.samples &&
+                 decoded.quality.valid && decoded.quality.flags == 0x1234) ? "pass" : "fail");
+    std::printf("C++ zero-copy views: %s\n", (res == AXDR_SUCCESS && views) ? "pass" : "fail");
+
+    // 约束来自模板参数
+    reading.samples.push_back(101);
+    axdr_codec_attach(&codec, buffer, sizeof(buffer));
+    res = axdr::encode(codec, reading);
+    std::printf("C++ constraint: %s\n", res == AXDR_ERROR_CONSTRAINT ? "pass" : "fail");
+
+    // 非法可视字符
+    reading.samples.pop_back();
+    reading.meter = "MTR\n01";
+    axdr_codec_attach(&codec, buffer, sizeof(buffer));
+    res = axdr::encode(codec, reading);
+    std::printf("C++ visible string check: %s\n",
+                (res == AXDR_ERROR_INVALID_VALUE && codec.errorOffset == 3) ? "pass" : "fail");
+
+    // 浮点字段与 C 接口编码一致
+    uint8_t floats[12];
+    axdr_codec_attach(&codec, floats, sizeof(floats));
+    axdr_encode_float32(&codec, 0.5f);
+    axdr_encode_float64(&codec, 1234.5);
+    Sample sample{0.5f, 1234.5};
+    axdr_codec_attach(&codec, buffer, sizeof(buffer));
+    res = axdr::encode(codec, sample);
+    Sample back{};
+    axdr_codec_attach(&codec, buffer, 12);
+    res |= axdr::decode(codec, back);
+    std::printf("C++ float fields: %s\n",
+                (res == AXDR_SUCCESS && std::memcmp(buffer, floats, 12) == 0 && back.power == 0.5f &&
+                 back.energy == 1234.5) ? "pass" : "fail");
+}
+
+int main() {
+    test_cpp();
+    return 0;
+}
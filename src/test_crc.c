@@ -0,0 +1,150 @@
+#include "axdr_crc.h"
+#include "axdr_batch.h"
+#include <stdio.h>
+#include <string.h>
+
+// 编码一帧：表号 + 若干读数 + 名称
+static int encode_frame(AXDR_CODEC* codec, uint32_t id) {
+    int res = axdr_encode_unsigned(codec, id, UINT32_MAX);
+    for (int i = 0; i < 20; i++) {
+        res |= axdr_encode_integer(codec, (int32_t)(id * 100) - i, INT32_MIN, INT32_MAX);
+    }
+    res |= axdr_encode_visible_string(codec, "1.0.99.1.0.255", 32);
+    return res;
+}
+
+void test_crc() {
+    printf("\nTesting Frame Check Sequence...\n");
+
+    // 标准校验值
+    const uint8_t check[] = "123456789";
+    printf("CRC-16/X.25 check value: %s\n", axdr_crc16_x25(check, 9) == 0x906E ? "pass" : "fail");
+    printf("CRC-32 check value: %s\n", axdr_crc32(check, 9) == 0xCBF43926u ? "pass" : "fail");
+
+    // slice-by-8 与逐字节、分段计算一致
+    uint8_t data[1000];
+    for (size_t i = 0; i < sizeof(data); i++) {
+        data[i] = (uint8_t)(i * 131 + 7);
+    }
+    int ok = 1;
+    for (int type = AXDR_CRC16_X25; type <= AXDR_CRC32; type++) {
+        uint32_t whole = axdr_crc_update(type, axdr_crc_init(type), data, sizeof(data));
+        uint32_t bytewise = axdr_crc_init(type);
+        for (size_t i = 0; i < sizeof(data); i++) {
+            bytewise = axdr_crc_update(type, bytewise, data + i, 1);
+        }
+        uint32_t split = axdr_crc_update(type, axdr_crc_init(type), data, 13);
+        split = axdr_crc_update(type, split, data + 13, sizeof(data) - 13);
+        ok &= whole == bytewise && whole == split;
+    }
+    printf("CRC incremental: %s\n", ok ? "pass" : "fail");
+
+    // 编码时追加 FCS，与整帧单独计算的结果一致
+    uint8_t buffer[512];
+    AXDR_CODEC codec;
+    ok = 1;
+    for (int type = AXDR_CRC16_X25; type <= AXDR_CRC32; type++) {
+        axdr_codec_attach(&codec, buffer, sizeof(buffer));
+        axdr_codec_set_checksum(&codec, type);
+        int res = encode_frame(&codec, 7);
+        size_t frameLength = codec.position;
+        // 编码函数已逐个计入，FCS 无需补算
+        ok &= codec.checksumMark == frameLength;
+        res |= axdr_encode_fcs(&codec);
+        uint32_t expected = type == AXDR_CRC16_X25 ? axdr_crc16_x25(buffer, frameLength)
+                                                    : axdr_crc32(buffer, frameLength);
+        uint32_t stored = 0;
+        for (size_t i = 0; i < axdr_crc_size(type); i++) {
+            stored |= (uint32_t)buffer[frameLength + i] << (8 * i);
+        }
+        ok &= res == AXDR_SUCCESS && codec.position == frameLength + axdr_crc_size(type) &&
+              stored == expected;
+
+        // 第二帧从 FCS 之后重新计算
+        size_t secondStart = codec.position;
+        res |= encode_frame(&codec, 8);
+        size_t secondLength = codec.position - secondStart;
+        ok &= axdr_codec_checksum(&codec) ==
+              (type == AXDR_CRC16_X25 ? axdr_crc16_x25(buffer + secondStart, secondLength)
+                                      : axdr_crc32(buffer + secondStart, secondLength));
+        res |= axdr_encode_fcs(&codec);
+
+        // 解码时边读边校验
+        size_t total = codec.position;
+        AXDR_CODEC input;
+        axdr_codec_attach(&input, buffer, total);
+        axdr_codec_set_checksum(&input, type);
+        for (uint32_t id = 7; id <= 8; id++) {
+            uint32_t decodedId = 0;
+            int32_t value = 0;
+            char name[33];
+            res |= axdr_decode_unsigned(&input, &decodedId, UINT32_MAX);
+            for (int i = 0; i < 20; i++) {
+                res |= axdr_decode_integer(&input, &value, INT32_MIN, INT32_MAX);
+            }
+            res |= axdr_decode_visible_string(&input, name, 32);
+            ok &= input.checksumMark == input.position;
+            res |= axdr_decode_fcs(&input);
+            ok &= decodedId == id;
+        }
+        ok &= res == AXDR_SUCCESS && input.position == total;
+    }
+    printf("Codec FCS encode and verify: %s\n", ok ? "pass" : "fail");
+
+    // 损坏的帧
+    axdr_codec_attach(&codec, buffer, sizeof(buffer));
+    axdr_codec_set_checksum(&codec, AXDR_CRC16_X25);
+    encode_frame(&codec, 9);
+    axdr_encode_fcs(&codec);
+    size_t total = codec.position;
+    buffer[10] ^= 0x04;
+    axdr_codec_attach(&codec, buffer, total);
+    axdr_codec_set_checksum(&codec, AXDR_CRC16_X25);
+    codec.position = total - 2;
+    int res = axdr_decode_fcs(&codec);
+    printf("Codec FCS mismatch: %s\n",
+           (res == AXDR_ERROR_CHECKSUM && codec.error == AXDR_ERROR_CHECKSUM &&
+            codec.errorOffset == total - 2 && codec.position == total - 2) ? "pass" : "fail");
+
+    // 批次回填长度：结束时整批计入，FCS 覆盖回填后的字节
+    axdr_codec_attach(&codec, buffer, sizeof(buffer));
+    axdr_codec_set_checksum(&codec, AXDR_CRC16_X25);
+    AXDR_BATCH_WRITER writer;
+    res = axdr_batch_begin(&writer, &codec);
+    for (uint32_t id = 1; id <= 3; id++) {
+        res |= axdr_batch_message_begin(&writer);
+        res |= encode_frame(&codec, id);
+        res |= axdr_batch_message_end(&writer);
+    }
+    res |= axdr_batch_end(&writer);
+    total = codec.position;
+    ok = res == AXDR_SUCCESS && codec.checksumMark == total && codec.checksumType == AXDR_CRC16_X25;
+    res = axdr_encode_fcs(&codec);
+    ok &= res == AXDR_SUCCESS && (buffer[total] | (buffer[total + 1] << 8)) == axdr_crc16_x25(buffer, total);
+    printf("Codec FCS over batch: %s\n", ok ? "pass" : "fail");
+
+    // 回退到已计入的位置之前
+    axdr_codec_attach(&codec, buffer, sizeof(buffer));
+    axdr_codec_set_checksum(&codec, AXDR_CRC32);
+    codec.position = 16;
+    axdr_codec_checksum_update(&codec);
+    codec.position = 8;
+    ok = axdr_codec_checksum_update(&codec) == AXDR_ERROR_INVALID_VALUE;
+    // 失败回退后重写的字节不会被计入：校验保持失效
+    axdr_encode_integer(&codec, 1, INT32_MIN, INT32_MAX);
+    axdr_encode_integer(&codec, 2, INT32_MIN, INT32_MAX);
+    axdr_encode_integer(&codec, 3, INT32_MIN, INT32_MAX);
+    ok &= codec.position == 20 && axdr_encode_fcs(&codec) == AXDR_ERROR_INVALID_VALUE;
+    ok &= axdr_codec_set_checksum(&codec, AXDR_CRC32) == AXDR_SUCCESS &&
+          axdr_encode_fcs(&codec) == AXDR_SUCCESS;
+    printf("Codec checksum rewind: %s\n", ok ? "pass" : "fail");
+
+    // 未开启校验模式
+    axdr_codec_attach(&codec, buffer, sizeof(buffer));
+    printf("Codec FCS disabled: %s\n", axdr_encode_fcs(&codec) == AXDR_ERROR_INVALID_VALUE ? "pass" : "fail");
+}
+
+int main() {
+    test_crc();
+    return 0;
+}
@@ -0,0 +1,196 @@
+#include "axdr_datetime.h"
+#include "axdr_export.h"
+#include "axdr_walk.h"
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+
+typedef struct {
+    uint32_t       id;
+    AXDR_DATE_TIME at;
+} DATED_RECORD;
+
+void test_datetime() {
+    printf("\nTesting Binary Date-Time...\n");
+
+    uint8_t buffer[1024];
+    AXDR_CODEC codec;
+
+    // 2023-11-14 22:13:20 UTC，中欧时间（UTC+1）为 23:13:20，星期二
+    AXDR_DATE_TIME value;
+    int res = axdr_date_time_from_time(&value, 1700000000, -60, AXDR_CLOCK_DST);
+    int ok = res == AXDR_SUCCESS && value.year == 2023 && value.month == 11 && value.day == 14 &&
+             value.weekday == 2 && value.hour == 23 && value.minute == 13 && value.second == 20 &&
+             value.deviation == -60 && value.status == AXDR_CLOCK_DST;
+    axdr_codec_attach(&codec, buffer, sizeof(buffer));
+    res = axdr_encode_date_time(&codec, &value);
+    static const uint8_t expected[12] = {0x07, 0xE7, 11, 14, 2, 23, 13, 20, 0, 0xFF, 0xC4, 0x80};
+    ok &= res == AXDR_SUCCESS && codec.position == 12 && memcmp(buffer, expected, 12) == 0;
+    AXDR_DATE_TIME decoded;
+    time_t utc = 0;
+    axdr_codec_attach(&codec, buffer, 12);
+    res = axdr_decode_date_time(&codec, &decoded);
+    res |= axdr_date_time_to_time(&decoded, &utc);
+    ok &= res == AXDR_SUCCESS && codec.position == 12 && utc == 1700000000;
+    printf("Date-time round trip: %s\n", ok ? "pass" : "fail");
+
+    // 与 gmtime 逐日对照，覆盖闰年、世纪年与 1970 年之前
+    ok = 1;
+    for (time_t t = -2208988800; t < 4102444800 && ok; t += 86400 * 7 + 3607) {
+        struct tm* tm = gmtime(&t);
+        res = axdr_date_time_from_time(&value, t, 0, 0);
+        ok &= res == AXDR_SUCCESS && value.year == tm->tm_year + 1900 && value.month == tm->tm_mon + 1 &&
+              value.day == tm->tm_mday && value.weekday == (tm->tm_wday == 0 ? 7 : tm->tm_wday) &&
+              value.hour == tm->tm_hour && value.minute == tm->tm_min && value.second == tm->tm_sec;
+        ok &= axdr_date_time_to_time(&value, &utc) == AXDR_SUCCESS && utc == t;
+    }
+    printf("Date-time calendar: %s\n", ok ? "pass" : "fail");
+
+    // 未指定字段可以编解码，但不能换算为 time_t
+    AXDR_DATE_TIME wildcard = {AXDR_DATE_TIME_YEAR_ANY, 12, AXDR_DATE_TIME_LAST_DAY, AXDR_DATE_TIME_ANY,
+                               0, 0, 0, AXDR_DATE_TIME_ANY, AXDR_DATE_TIME_DEVIATION_ANY, AXDR_DATE_TIME_ANY};
+    axdr_codec_attach(&codec, buffer, sizeof(buffer));
+    res = axdr_encode_date_time(&codec, &wildcard);
+    axdr_codec_attach(&codec, buffer, 12);
+    res |= axdr_decode_date_time(&codec, &decoded);
+    ok = res == AXDR_SUCCESS && decoded.day == AXDR_DATE_TIME_LAST_DAY &&
+         decoded.deviation == AXDR_DATE_TIME_DEVIATION_ANY &&
+         axdr_date_time_to_time(&decoded, &utc) == AXDR_ERROR_INVALID_VALUE;
+    printf("Date-time unspecified: %s\n", ok ? "pass" : "fail");
+
+    // 非法字段：解码失败时不前移，errorOffset 指向该字节
+    buffer[6] = 60;
+    axdr_codec_attach(&codec, buffer, 12);
+    res = axdr_decode_date_time(&codec, &decoded);
+    ok = res == AXDR_ERROR_INVALID_VALUE && codec.position == 0 && codec.errorOffset == 6;
+    value.deviation = 900;
+    axdr_codec_attach(&codec, buffer, sizeof(buffer));
+    ok &= axdr_encode_date_time(&codec, &value) == AXDR_ERROR_INVALID_VALUE && codec.position == 0;
+    axdr_codec_attach(&codec, buffer, 11);
+    ok &= axdr_decode_date_time(&codec, &decoded) == AXDR_ERROR_BUFFER_OVERFLOW;
+    printf("Date-time invalid: %s\n", ok ? "pass" : "fail");
+
+    // 批量：15 分钟间隔的负荷曲线，跨越日界与年界
+    time_t times[64];
+    time_t back[64];
+    for (size_t i = 0; i < 64; i++) {
+        times[i] = 1704063600 - 8 * 900 + (time_t)i * 900;    // 2023-12-31 21:00 UTC 起
+    }
+    axdr_codec_attach(&codec, buffer, sizeof(buffer));
+    res = axdr_encode_date_time_array(&codec, times, 64, -60, 0);
+    size_t encoded = codec.position;
+    ok = res == AXDR_SUCCESS && encoded == 4 + 64 * 12;
+    size_t count = 0;
+    axdr_codec_attach(&codec, buffer, encoded);
+    res = axdr_decode_date_time_array(&codec, back, NULL, &count, 64);
+    ok &= res == AXDR_SUCCESS && count == 64 && codec.position == encoded &&
+          memcmp(times, back, sizeof(times)) == 0;
+    // 与逐个编码的结果一致
+    for (size_t i = 0; i < 64 && ok; i++) {
+        AXDR_CODEC single;
+        uint8_t one[12];
+        axdr_codec_attach(&single, one, sizeof(one));
+        axdr_date_time_from_time(&value, times[i], -60, 0);
+        axdr_encode_date_time(&single, &value);
+        ok &= memcmp(one, buffer + 4 + i * 12, 12) == 0;
+    }
+    printf("Date-time array: %s\n", ok ? "pass" : "fail");
+
+    // 批量解码：个数超限、预算与含未指定字段的元素
+    axdr_codec_attach(&codec, buffer, encoded);
+    ok = axdr_decode_date_time_array(&codec, back, NULL, &count, 32) == AXDR_ERROR_CONSTRAINT && codec.position == 0;
+    AXDR_DECODE_BUDGET budget;
+    axdr_budget_init(&budget, 0, 16, 0, 0);
+    axdr_codec_attach(&codec, buffer, encoded);
+    codec.budget = &budget;
+    ok &= axdr_decode_date_time_array(&codec, back, NULL, &count, 64) == AXDR_ERROR_BUDGET && codec.position == 0;
+    buffer[4 + 10 * 12 + 5] = AXDR_DATE_TIME_ANY;
+    axdr_codec_attach(&codec, buffer, encoded);
+    ok &= axdr_decode_date_time_array(&codec, back, NULL, &count, 64) == AXDR_ERROR_INVALID_VALUE &&
+          codec.position == 0 && codec.errorOffset == 4 + 10 * 12 + 5;
+    printf("Date-time array limits: %s\n", ok ? "pass" : "fail");
+
+    // 时钟状态：取状态时逐个返回，不取时拒绝无效或可疑的元素
+    uint8_t status[64];
+    axdr_codec_attach(&codec, buffer, sizeof(buffer));
+    res = axdr_encode_date_time_array(&codec, times, 64, -60, AXDR_CLOCK_DST);
+    buffer[4 + 3 * 12 + 11] = AXDR_CLOCK_DOUBTFUL;
+    buffer[4 + 7 * 12 + 11] = AXDR_DATE_TIME_ANY;
+    axdr_codec_attach(&codec, buffer, encoded);
+    res |= axdr_decode_date_time_array(&codec, back, status, &count, 64);
+    ok = res == AXDR_SUCCESS && count == 64 && memcmp(times, back, sizeof(times)) == 0 &&
+         status[0] == AXDR_CLOCK_DST && status[3] == AXDR_CLOCK_DOUBTFUL && status[7] == AXDR_DATE_TIME_ANY;
+    axdr_codec_attach(&codec, buffer, encoded);
+    ok &= axdr_decode_date_time_array(&codec, back, NULL, &count, 64) == AXDR_ERROR_INVALID_VALUE &&
+          codec.position == 0 && codec.errorOffset == 4 + 3 * 12 + 11;
+    buffer[4 + 3 * 12 + 11] = AXDR_CLOCK_INVALID | AXDR_CLOCK_DST;
+    axdr_codec_attach(&codec, buffer, encoded);
+    ok &= axdr_decode_date_time_array(&codec, back, NULL, &count, 64) == AXDR_ERROR_INVALID_VALUE &&
+          codec.errorOffset == 4 + 3 * 12 + 11;
+    printf("Date-time array status: %s\n", ok ? "pass" : "fail");
+
+    // 日超过当月天数：闰年的 02-29 合法，平年的 02-29 与 02-31、04-31 非法
+    AXDR_DATE_TIME day = {2024, 2, 29, AXDR_DATE_TIME_ANY, 12, 0, 0, 0, 0, 0};
+    ok = axdr_date_time_to_time(&day, &utc) == AXDR_SUCCESS && utc == 1709208000;
+    day.year = 2000;
+    ok &= axdr_date_time_to_time(&day, &utc) == AXDR_SUCCESS;
+    day.year = AXDR_DATE_TIME_YEAR_ANY;
+    axdr_codec_attach(&codec, buffer, sizeof(buffer));
+    ok &= axdr_encode_date_time(&codec, &day) == AXDR_SUCCESS;
+    const AXDR_DATE_TIME impossible[4] = {
+        {2023, 2, 29, AXDR_DATE_TIME_ANY, 12, 0, 0, 0, 0, 0},
+        {1900, 2, 29, AXDR_DATE_TIME_ANY, 12, 0, 0, 0, 0, 0},
+        {2024, 2, 31, AXDR_DATE_TIME_ANY, 12, 0, 0, 0, 0, 0},
+        {AXDR_DATE_TIME_YEAR_ANY, 4, 31, AXDR_DATE_TIME_ANY, 12, 0, 0, 0, 0, 0},
+    };
+    for (int i = 0; i < 4; i++) {
+        ok &= axdr_date_time_to_time(&impossible[i], &utc) == AXDR_ERROR_INVALID_VALUE;
+        axdr_codec_attach(&codec, buffer, sizeof(buffer));
+        ok &= axdr_encode_date_time(&codec, &impossible[i]) == AXDR_ERROR_INVALID_VALUE && codec.position == 0;
+    }
+    // 解码：errorOffset 指向日
+    axdr_codec_attach(&codec, buffer, sizeof(buffer));
+    axdr_encode_date_time(&codec, &value);
+    buffer[2] = 4;
+    buffer[3] = 31;
+    axdr_codec_attach(&codec, buffer, 12);
+    ok &= axdr_decode_date_time(&codec, &decoded) == AXDR_ERROR_INVALID_VALUE && codec.errorOffset == 3;
+    printf("Date-time day of month: %s\n", ok ? "pass" : "fail");
+
+    // 模式：遍历解码与导出
+    AXDR_SCHEMA* schema = axdr_schema_parse("{id:uint, at:datetime}");
+    ok = schema && schema->childCount == 2 && schema->children[1].type == AXDR_TYPE_DATE_TIME;
+    if (schema) {
+        DATED_RECORD record;
+        AXDR_SCHEMA* fields = (AXDR_SCHEMA*)schema->children;
+        fields[0].offset = offsetof(DATED_RECORD, id);
+        fields[1].offset = offsetof(DATED_RECORD, at);
+        axdr_codec_attach(&codec, buffer, sizeof(buffer));
+        axdr_encode_unsigned(&codec, 7, UINT32_MAX);
+        axdr_date_time_from_time(&value, 1700000000, -60, 0);
+        axdr_encode_date_time(&codec, &value);
+        encoded = codec.position;
+
+        AXDR_WALK_FRAME frames[AXDR_WALK_DEFAULT_DEPTH];
+        AXDR_WALKER walker;
+        axdr_walker_init(&walker, frames, AXDR_WALK_DEFAULT_DEPTH);
+        axdr_codec_attach(&codec, buffer, encoded);
+        res = axdr_walk_decode(&walker, &codec, schema, &record);
+        ok &= res == AXDR_SUCCESS && record.id == 7 && record.at.hour == 23 && record.at.deviation == -60;
+
+        char out[256];
+        AXDR_EXPORTER exporter;
+        axdr_exporter_init(&exporter, AXDR_EXPORT_JSON, out, sizeof(out), -1);
+        axdr_codec_attach(&codec, buffer, encoded);
+        res = axdr_export_record(&exporter, &codec, schema);
+        const char* json = "{\"id\":7,\"at\":\"2023-11-14T23:13:20+01:00\"}\n";
+        ok &= res == AXDR_SUCCESS && exporter.length == strlen(json) && memcmp(out, json, exporter.length) == 0;
+        axdr_schema_free(schema);
+    }
+    printf("Date-time schema: %s\n", ok ? "pass" : "fail");
+}
+
+int main() {
+    test_datetime();
+    return 0;
+}
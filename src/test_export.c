@@ -0,0 +1,169 @@
+#include "axdr_export.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#define READING_SCHEMA \
+    "{id:uint, active:bool, name:string(32), readings:[int](8), raw:octets, at:time, state:enum(4)}"
+
+// 一条抄表记录
+static size_t encode_reading(uint8_t* buffer, size_t size, const char* name) {
+    const int32_t readings[3] = {-5, 0, 123456};
+    const uint8_t raw[3] = {0x00, 0xAB, 0x7F};
+    AXDR_CODEC codec;
+    axdr_codec_attach(&codec, buffer, size);
+    int res = axdr_encode_unsigned(&codec, 42, UINT32_MAX);
+    res |= axdr_encode_boolean(&codec, true);
+    res |= axdr_encode_visible_string(&codec, name, 32);
+    res |= axdr_encode_unsigned(&codec, 3, 8);
+    for (int i = 0; i < 3; i++) {
+        res |= axdr_encode_integer(&codec, readings[i], INT32_MIN, INT32_MAX);
+    }
+    res |= axdr_encode_octet_string(&codec, raw, sizeof(raw));
+    res |= axdr_encode_generalized_time(&codec, 1700000000);
+    res |= axdr_encode_enum(&codec, 2, 4);
+    return res == AXDR_SUCCESS ? codec.position : 0;
+}
+
+void test_export() {
+    printf("\nTesting Streaming Export...\n");
+
+    AXDR_SCHEMA* schema = axdr_schema_parse(READING_SCHEMA);
+    printf("Schema parse: %s\n", (schema && schema->type == AXDR_TYPE_SEQUENCE &&
+                                  schema->childCount == 7) ? "pass" : "fail");
+    if (!schema) {
+        return;
+    }
+
+    uint8_t frame[256];
+    size_t frameLength = encode_reading(frame, sizeof(frame), "east \"A\"");
+
+    char out[512];
+    AXDR_EXPORTER exporter;
+    AXDR_CODEC codec;
+
+    // JSON
+    axdr_exporter_init(&exporter, AXDR_EXPORT_JSON, out, sizeof(out), -1);
+    axdr_codec_attach(&codec, frame, frameLength);
+    int res = axdr_export_record(&exporter, &codec, schema);
+    const char* json =
+        "{\"id\":42,\"active\":true,\"name\":\"east \\\"A\\\"\",\"readings\":[-5,0,123456],"
+        "\"raw\":\"00ab7f\",\"at\":\"2023-11-14T22:13:20Z\",\"state\":2}\n";
+    printf("JSON export: %s\n", (res == AXDR_SUCCESS && codec.position == frameLength &&
+                                 exporter.length == strlen(json) &&
+                                 memcmp(out, json, exporter.length) == 0) ? "pass" : "fail");
+
+    // CSV：表头与数据行
+    axdr_exporter_init(&exporter, AXDR_EXPORT_CSV, out, sizeof(out), -1);
+    axdr_codec_attach(&codec, frame, frameLength);
+    res = axdr_export_csv_header(&exporter, schema);
+    res |= axdr_export_record(&exporter, &codec, schema);
+    const char* csv =
+        "id,active,name,readings,raw,at,state\n"
+        "42,true,\"east \"\"A\"\"\",\"[-5,0,123456]\",\"00ab7f\",\"2023-11-14T22:13:20Z\",2\n";
+    printf("CSV export: %s\n", (res == AXDR_SUCCESS && exporter.length == strlen(csv) &&
+                                memcmp(out, csv, exporter.length) == 0) ? "pass" : "fail");
+
+    // 输出缓冲区不足：不留下半条记录
+    char small[AXDR_EXPORT_MIN_BUFFER];
+    axdr_exporter_init(&exporter, AXDR_EXPORT_JSON, small, sizeof(small), -1);
+    axdr_codec_attach(&codec, frame, frameLength);
+    res = axdr_export_record(&exporter, &codec, schema);
+    printf("Export overflow: %s\n", (res == AXDR_ERROR_BUFFER_OVERFLOW && exporter.length == 0 &&
+                                     codec.position == 0) ? "pass" : "fail");
+
+    // 写入 fd：小缓冲区多次刷出，结果与一次写入一致
+    char path[] = "/tmp/axdr_export_XXXXXX";
+    int fd = mkstemp(path);
+    axdr_exporter_init(&exporter, AXDR_EXPORT_JSON, small, sizeof(small), fd);
+    res = AXDR_SUCCESS;
+    for (int i = 0; i < 10; i++) {
+        axdr_codec_attach(&codec, frame, frameLength);
+        res |= axdr_export_record(&exporter, &codec, schema);
+    }
+    res |= axdr_exporter_flush(&exporter);
+    char* readback = (char*)malloc(strlen(json) * 10 + 1);
+    ssize_t n = pread(fd, readback, strlen(json) * 10 + 1, 0);
+    int same = n == (ssize_t)(strlen(json) * 10);
+    for (int i = 0; same && i < 10; i++) {
+        same = memcmp(readback + i * strlen(json), json, strlen(json)) == 0;
+    }
+    printf("Export to fd: %s\n", (res == AXDR_SUCCESS && same) ? "pass" : "fail");
+    free(readback);
+    close(fd);
+    unlink(path);
+
+    // JSON 中 0x20-0x7E 以外的字节转义为 \u00XX（可变长度可视串不校验字符范围）
+    AXDR_SCHEMA* text = axdr_schema_parse("{s:varstring}");
+    uint8_t raw[8] = {6, 'a', 0x7F, 0xC3, 0xA9, 0x01, 'z'};
+    axdr_exporter_init(&exporter, AXDR_EXPORT_JSON, out, sizeof(out), -1);
+    axdr_codec_attach(&codec, raw, 7);
+    res = text ? axdr_export_record(&exporter, &codec, text) : AXDR_ERROR_INVALID_VALUE;
+    const char* escaped = "{\"s\":\"a\\u007f\\u00c3\\u00a9\\u0001z\"}\n";
+    printf("Export escape: %s\n", (res == AXDR_SUCCESS && exporter.length == strlen(escaped) &&
+                                   memcmp(out, escaped, exporter.length) == 0) ? "pass" : "fail");
+    axdr_schema_free(text);
+
+    // 可视串与 axdr_decode_visible_string 同样校验：返回 AXDR_ERROR_INVALID_VALUE，
+    // errorOffset 相同，不输出半条记录
+    memcpy(raw, "\0\0\0\3ab\x7f", 7);
+    AXDR_SCHEMA* fixed = axdr_schema_parse("{s:string}");
+    axdr_exporter_init(&exporter, AXDR_EXPORT_JSON, out, sizeof(out), -1);
+    axdr_codec_attach(&codec, raw, 7);
+    res = fixed ? axdr_export_record(&exporter, &codec, fixed) : AXDR_ERROR_INVALID_VALUE;
+    int ok = res == AXDR_ERROR_INVALID_VALUE && codec.errorOffset == 6 && exporter.length == 0;
+    char str[16];
+    axdr_codec_attach(&codec, raw, 7);
+    ok &= axdr_decode_visible_string(&codec, str, 15) == AXDR_ERROR_INVALID_VALUE && codec.errorOffset == 6;
+    printf("Export visible string: %s\n", ok ? "pass" : "fail");
+    axdr_schema_free(fixed);
+
+    // 违反模式约束
+    AXDR_SCHEMA* strict = axdr_schema_parse("{id:uint(10), active:bool}");
+    axdr_exporter_init(&exporter, AXDR_EXPORT_JSON, out, sizeof(out), -1);
+    axdr_codec_attach(&codec, frame, frameLength);
+    res = axdr_export_record(&exporter, &codec, strict);
+    printf("Export constraint: %s\n", res == AXDR_ERROR_CONSTRAINT ? "pass" : "fail");
+    axdr_schema_free(strict);
+
+    // SEQUENCE OF 个数：零宽元素受预算限制，定长元素不能超过剩余字节
+    AXDR_SCHEMA* nulls = axdr_schema_parse("{items:[null]}");
+    AXDR_SCHEMA* ints = axdr_schema_parse("{items:[int]}");
+    uint8_t huge[4] = {0xFF, 0xFF, 0xFF, 0xFF};
+    AXDR_DECODE_BUDGET budget;
+    axdr_budget_init(&budget, 0, 1000, 0, 0);
+    axdr_exporter_init(&exporter, AXDR_EXPORT_JSON, out, sizeof(out), -1);
+    axdr_codec_attach(&codec, huge, sizeof(huge));
+    codec.budget = &budget;
+    ok = nulls && ints && axdr_export_record(&exporter, &codec, nulls) == AXDR_ERROR_BUDGET &&
+             exporter.length == 0 && budget.depth == 0;
+    axdr_codec_attach(&codec, huge, sizeof(huge));
+    ok &= ints && axdr_export_record(&exporter, &codec, ints) == AXDR_ERROR_BUFFER_OVERFLOW && exporter.length == 0;
+    printf("Export sequence limits: %s\n", ok ? "pass" : "fail");
+    axdr_schema_free(nulls);
+    axdr_schema_free(ints);
+
+    // 模式语法错误
+    printf("Schema syntax error: %s\n",
+           (!axdr_schema_parse("{id:int,") && !axdr_schema_parse("{x:float}")) ? "pass" : "fail");
+
+    // 界限超出类型范围、为负或 min > max
+    const char* badBounds[] = {"octets(-1)", "string(-1)", "[int](-1)", "int(10,-10)", "int(-5000000000,0)",
+                               "enum(0)", "uint(-1)", "uint(4294967296)", "varstring(99999999999999999999)"};
+    ok = 1;
+    for (size_t i = 0; i < sizeof(badBounds) / sizeof(badBounds[0]); i++) {
+        ok &= axdr_schema_parse(badBounds[i]) == NULL;
+    }
+    AXDR_SCHEMA* edges = axdr_schema_parse("{a:int(-2147483648,2147483647), b:uint(4294967295), c:enum(1), d:int(5,5)}");
+    ok &= edges && edges->children[0].min == INT32_MIN && edges->children[1].max == UINT32_MAX;
+    axdr_schema_free(edges);
+    printf("Schema bounds: %s\n", ok ? "pass" : "fail");
+
+    axdr_schema_free(schema);
+}
+
+int main() {
+    test_export();
+    return 0;
+}
@@ -0,0 +1,121 @@
+#include "axdr_fingerprint.h"
+#include <stdio.h>
+#include <string.h>
+
+// 定长读数：{time, value, status, captured}，time 与 captured 为易变字段
+static const AXDR_SCHEMA fixed_fields[] = {
+    {.type = AXDR_TYPE_UNSIGNED, .name = "time", .max = UINT32_MAX},
+    {.type = AXDR_TYPE_INTEGER, .name = "value", .min = INT32_MIN, .max = INT32_MAX},
+    {.type = AXDR_TYPE_BOOLEAN, .name = "status"},
+    {.type = AXDR_TYPE_UNSIGNED, .name = "captured", .max = UINT32_MAX},
+};
+static const AXDR_SCHEMA fixed_schema = {.type = AXDR_TYPE_SEQUENCE, .children = fixed_fields, .childCount = 4};
+
+// 易变字段前有变长字段：{meter, readings[], time}
+static const AXDR_SCHEMA reading_schema[] = {{.type = AXDR_TYPE_INTEGER, .min = INT32_MIN, .max = INT32_MAX}};
+static const AXDR_SCHEMA variable_fields[] = {
+    {.type = AXDR_TYPE_VISIBLE_STRING, .name = "meter", .maxLength = 32},
+    {.type = AXDR_TYPE_SEQUENCE_OF, .name = "readings", .maxLength = 16, .children = reading_schema, .childCount = 1},
+    {.type = AXDR_TYPE_UNSIGNED, .name = "time", .max = UINT32_MAX},
+};
+static const AXDR_SCHEMA variable_schema = {.type = AXDR_TYPE_SEQUENCE, .children = variable_fields, .childCount = 3};
+
+static size_t encode_fixed(uint8_t* buffer, uint32_t time, int32_t value, uint32_t captured) {
+    AXDR_CODEC codec;
+    axdr_codec_attach(&codec, buffer, 64);
+    axdr_encode_unsigned(&codec, 13, UINT32_MAX);   // 长度前缀
+    axdr_encode_unsigned(&codec, time, UINT32_MAX);
+    axdr_encode_integer(&codec, value, INT32_MIN, INT32_MAX);
+    axdr_encode_boolean(&codec, true);
+    axdr_encode_unsigned(&codec, captured, UINT32_MAX);
+    return codec.position;
+}
+
+static size_t encode_variable(uint8_t* buffer, const char* meter, size_t readings, int32_t value, uint32_t time) {
+    AXDR_CODEC codec;
+    axdr_codec_attach(&codec, buffer, 256);
+    axdr_encode_visible_string(&codec, meter, 32);
+    axdr_encode_unsigned(&codec, (uint32_t)readings, 16);
+    for (size_t i = 0; i < readings; i++) {
+        axdr_encode_integer(&codec, value + (int32_t)i, INT32_MIN, INT32_MAX);
+    }
+    axdr_encode_unsigned(&codec, time, UINT32_MAX);
+    return codec.position;
+}
+
+void test_fingerprint() {
+    printf("\nTesting Frame Fingerprints...\n");
+
+    uint8_t a[256], b[256];
+    uint64_t fa, fb;
+
+    // 定长字段：排除范围预先算出
+    const char* fixedVolatile[] = {"time", "captured"};
+    AXDR_FINGERPRINT_PLAN plan;
+    int res = axdr_fingerprint_plan_init(&plan, &fixed_schema, fixedVolatile, 2, 4);
+    size_t la = encode_fixed(a, 1000, 42, 7);
+    size_t lb = encode_fixed(b, 2000, 42, 8);
+    res |= axdr_fingerprint(&plan, a, la, &fa);
+    res |= axdr_fingerprint(&plan, b, lb, &fb);
+    int ok = res == AXDR_SUCCESS && plan.fixed && plan.excludedCount == 2 &&
+             plan.excluded[0].offset == 4 && plan.excluded[1].offset == 13 && fa == fb && fa != 0;
+    lb = encode_fixed(b, 2000, 43, 8);
+    axdr_fingerprint(&plan, b, lb, &fb);
+    ok &= fa != fb;
+    printf("Fingerprint fixed exclusion: %s\n", ok ? "pass" : "fail");
+
+    // 变长字段之后的易变字段：遍历定位
+    const char* variableVolatile[] = {"time"};
+    res = axdr_fingerprint_plan_init(&plan, &variable_schema, variableVolatile, 1, 0);
+    la = encode_variable(a, "1.0.99.1.0.255", 5, 100, 1000);
+    lb = encode_variable(b, "1.0.99.1.0.255", 5, 100, 2000);
+    res |= axdr_fingerprint(&plan, a, la, &fa);
+    res |= axdr_fingerprint(&plan, b, lb, &fb);
+    ok = res == AXDR_SUCCESS && !plan.fixed && fa == fb;
+    lb = encode_variable(b, "1.0.99.1.0.255", 6, 100, 1000);
+    axdr_fingerprint(&plan, b, lb, &fb);
+    ok &= fa != fb;
+    lb = encode_variable(b, "1.0.99.2.0.255", 5, 100, 1000);
+    axdr_fingerprint(&plan, b, lb, &fb);
+    ok &= fa != fb;
+    printf("Fingerprint schema walk: %s\n", ok ? "pass" : "fail");
+
+    // 截断的帧无法定位字段
+    printf("Fingerprint truncated: %s\n",
+           axdr_fingerprint(&plan, a, la - 6, &fa) == AXDR_ERROR_BUFFER_OVERFLOW ? "pass" : "fail");
+
+    // 整帧指纹
+    res = axdr_fingerprint_plan_init(&plan, NULL, NULL, 0, 0);
+    la = encode_variable(a, "x", 2, 1, 1000);
+    lb = encode_variable(b, "x", 2, 1, 2000);
+    res |= axdr_fingerprint(&plan, a, la, &fa);
+    res |= axdr_fingerprint(&plan, b, lb, &fb);
+    printf("Fingerprint whole frame: %s\n", (res == AXDR_SUCCESS && fa != fb) ? "pass" : "fail");
+
+    // 未知字段名
+    const char* unknown[] = {"timestamp"};
+    printf("Fingerprint unknown field: %s\n",
+           axdr_fingerprint_plan_init(&plan, &fixed_schema, unknown, 1, 0) == AXDR_ERROR_INVALID_VALUE
+               ? "pass" : "fail");
+
+    // 数据源表
+    AXDR_FINGERPRINT_TABLE* table = axdr_fingerprint_table_create(4);
+    ok = table != NULL;
+    if (table) {
+        ok &= axdr_fingerprint_table_check(table, 1, 0x11) == 0;
+        ok &= axdr_fingerprint_table_check(table, 1, 0x11) == 1;
+        ok &= axdr_fingerprint_table_check(table, 2, 0x11) == 0;
+        ok &= axdr_fingerprint_table_check(table, 1, 0x13) == 0;
+        axdr_fingerprint_table_forget(table, 1);
+        ok &= axdr_fingerprint_table_check(table, 1, 0x13) == 0;
+        ok &= axdr_fingerprint_table_check(table, 4, 0x13) == AXDR_ERROR_INVALID_VALUE;
+        ok &= table->unchanged == 1 && table->changed == 4;
+        axdr_fingerprint_table_destroy(table);
+    }
+    printf("Fingerprint source table: %s\n", ok ? "pass" : "fail");
+}
+
+int main() {
+    test_fingerprint();
+    return 0;
+}
@@ -0,0 +1,213 @@
+#define _GNU_SOURCE
+#include "axdr_ingest.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <termios.h>
+#include <unistd.h>
+#include <sys/socket.h>
+
+typedef struct {
+    int     frames;
+    int32_t expected;
+    int     ok;
+    int     closed;
+} IngestResult;
+
+static int check_frame(void* ctx, int sourceId, AXDR_CODEC* frame) {
+    IngestResult* result = (IngestResult*)ctx;
+    (void)sourceId;
+    if (!frame) {
+        result->closed = 1;
+        return AXDR_SUCCESS;
+    }
+
+    uint32_t length;
+    int32_t value;
+    if (axdr_decode_unsigned(frame, &length, UINT32_MAX) != AXDR_SUCCESS || length != 8 ||
+        axdr_decode_integer(frame, &value, INT32_MIN, INT32_MAX) != AXDR_SUCCESS ||
+        value != result->expected) {
+        result->ok = 0;
+    }
+    result->expected++;
+    result->frames++;
+    return AXDR_SUCCESS;
+}
+
+// 写入 count 个长度前缀帧，按不规则的块大小切分，模拟跨多次接收的帧
+static int write_frames(int fd, int count) {
+    uint8_t stream[4096];
+    AXDR_CODEC codec;
+    axdr_codec_attach(&codec, stream, sizeof(stream));
+    for (int32_t i = 0; i < count; i++) {
+        axdr_encode_unsigned(&codec, 8, UINT32_MAX);
+        axdr_encode_integer(&codec, i, INT32_MIN, INT32_MAX);
+        axdr_encode_integer(&codec, -i, INT32_MIN, INT32_MAX);
+    }
+
+    size_t offset = 0;
+    size_t step = 1;
+    while (offset < codec.position) {
+        size_t n = codec.position - offset < step ? codec.position - offset : step;
+        if (write(fd, stream + offset, n) != (ssize_t)n) {
+            return -1;
+        }
+        offset += n;
+        step = step * 7 % 29 + 1;
+    }
+    return 0;
+}
+
+static void run_ingest(const char* name, int backend, int readFd, int writeFd) {
+    IngestResult result = {0, 0, 1, 0};
+    AXDR_INGEST_CONFIG config = {
+        .backend = backend,
+        .maxSources = 4,
+        .frameLength = axdr_ingest_length_prefixed,
+        .handler = check_frame,
+        .ctx = &result,
+    };
+    AXDR_INGEST* ingest = axdr_ingest_create(&config);
+    if (!ingest) {
+        printf("Ingest %s: skipped (backend unavailable)\n", name);
+        return;
+    }
+
+    int id = axdr_ingest_add(ingest, readFd);
+    int ok = id >= 0 && write_frames(writeFd, 100) == 0;
+    for (int spins = 0; ok && result.frames < 100 && spins < 1000; spins++) {
+        if (axdr_ingest_poll(ingest, 100) < 0) {
+            ok = 0;
+        }
+    }
+    printf("Ingest %s: %s\n", name, (ok && result.ok && result.frames == 100) ? "pass" : "fail");
+    axdr_ingest_destroy(ingest);
+}
+
+static void run_close(const char* name, int backend) {
+    int fds[2];
+    if (socketpair(AF_UNIX, SOCK_STREAM, 0, fds) != 0) {
+        return;
+    }
+    IngestResult result = {0, 0, 1, 0};
+    AXDR_INGEST_CONFIG config = {
+        .backend = backend,
+        .maxSources = 1,
+        .frameLength = axdr_ingest_length_prefixed,
+        .handler = check_frame,
+        .ctx = &result,
+    };
+    AXDR_INGEST* ingest = axdr_ingest_create(&config);
+    if (ingest) {
+        axdr_ingest_add(ingest, fds[0]);
+        close(fds[1]);
+        for (int spins = 0; !result.closed && spins < 100; spins++) {
+            axdr_ingest_poll(ingest, 100);
+        }
+        printf("Ingest %s close: %s\n", name, result.closed ? "pass" : "fail");
+        axdr_ingest_destroy(ingest);
+    }
+    close(fds[0]);
+}
+
+static int count_frame(void* ctx, int sourceId, AXDR_CODEC* frame) {
+    (void)sourceId;
+    if (frame) {
+        (*(int*)ctx)++;
+    }
+    return AXDR_SUCCESS;
+}
+
+// 读数不变、只有时间戳变化的帧按指纹跳过
+static void run_fingerprint(const char* name, int backend) {
+    static const AXDR_SCHEMA fields[] = {
+        {.type = AXDR_TYPE_INTEGER, .name = "value", .min = INT32_MIN, .max = INT32_MAX},
+        {.type = AXDR_TYPE_UNSIGNED, .name = "time", .max = UINT32_MAX},
+    };
+    static const AXDR_SCHEMA schema = {.type = AXDR_TYPE_SEQUENCE, .children = fields, .childCount = 2};
+    const char* volatileFields[] = {"time"};
+    AXDR_FINGERPRINT_PLAN plan;
+    axdr_fingerprint_plan_init(&plan, &schema, volatileFields, 1, 4);
+
+    int fds[2];
+    if (socketpair(AF_UNIX, SOCK_STREAM, 0, fds) != 0) {
+        return;
+    }
+    int delivered = 0;
+    AXDR_INGEST_CONFIG config = {
+        .backend = backend,
+        .maxSources = 1,
+        .frameLength = axdr_ingest_length_prefixed,
+        .handler = count_frame,
+        .ctx = &delivered,
+        .fingerprint = &plan,
+    };
+    AXDR_INGEST* ingest = axdr_ingest_create(&config);
+    if (ingest) {
+        // 读数 0,0,0,1,1,1,...,9,9,9，时间戳逐帧递增
+        uint8_t stream[512];
+        AXDR_CODEC codec;
+        axdr_codec_attach(&codec, stream, sizeof(stream));
+        for (uint32_t i = 0; i < 30; i++) {
+            axdr_encode_unsigned(&codec, 8, UINT32_MAX);
+            axdr_encode_integer(&codec, (int32_t)(i / 3), INT32_MIN, INT32_MAX);
+            axdr_encode_unsigned(&codec, 1700000000u + i * 900, UINT32_MAX);
+        }
+        axdr_ingest_add(ingest, fds[0]);
+        int ok = write(fds[1], stream, codec.position) == (ssize_t)codec.position;
+        for (int spins = 0; ok && ingest->fingerprints->changed + ingest->fingerprints->unchanged < 30 &&
+                            spins < 100; spins++) {
+            axdr_ingest_poll(ingest, 100);
+        }
+        printf("Ingest %s fingerprint skip: %s\n", name,
+               (ok && delivered == 10 && ingest->fingerprints->unchanged == 20) ? "pass" : "fail");
+        axdr_ingest_destroy(ingest);
+    }
+    close(fds[0]);
+    close(fds[1]);
+}
+
+void test_ingest() {
+    printf("\nTesting Frame Ingest Pipeline...\n");
+    const int backends[] = {AXDR_INGEST_IO_URING, AXDR_INGEST_EPOLL};
+    const char* names[] = {"io_uring", "epoll"};
+
+    for (int b = 0; b < 2; b++) {
+        char name[64];
+        int fds[2];
+        if (socketpair(AF_UNIX, SOCK_STREAM, 0, fds) == 0) {
+            snprintf(name, sizeof(name), "%s socketpair", names[b]);
+            run_ingest(name, backends[b], fds[0], fds[1]);
+            close(fds[0]);
+            close(fds[1]);
+        }
+
+        // pty 原始模式，模拟串口桥接
+        int master = posix_openpt(O_RDWR | O_NOCTTY);
+        if (master >= 0 && grantpt(master) == 0 && unlockpt(master) == 0) {
+            int slave = open(ptsname(master), O_RDWR | O_NOCTTY);
+            struct termios tio;
+            if (slave >= 0 && tcgetattr(slave, &tio) == 0) {
+                cfmakeraw(&tio);
+                tcsetattr(slave, TCSANOW, &tio);
+                snprintf(name, sizeof(name), "%s pty", names[b]);
+                run_ingest(name, backends[b], master, slave);
+            }
+            if (slave >= 0) {
+                close(slave);
+            }
+        }
+        if (master >= 0) {
+            close(master);
+        }
+
+        run_close(names[b], backends[b]);
+        run_fingerprint(names[b], backends[b]);
+    }
+}
+
+int main() {
+    test_ingest();
+    return 0;
+}
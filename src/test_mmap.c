@@ -0,0 +1,73 @@
+#include "axdr_mmap.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+void test_mmap_codec() {
+    printf("\nTesting mmap Codec Encoding/Decoding...\n");
+    char path[] = "/tmp/axdr_mmap_XXXXXX";
+    int fd = mkstemp(path);
+    if (fd < 0) {
+        printf("mmap test skipped: cannot create temp file\n");
+        return;
+    }
+    close(fd);
+
+    // 追加编码，预留空间不足时扩展
+    AXDR_MMAP_CODEC* writer = axdr_mmap_codec_open_append(path, 16);
+    int res = writer ? AXDR_SUCCESS : AXDR_ERROR_INVALID_VALUE;
+    for (int32_t i = 0; i < 50000 && res == AXDR_SUCCESS; i++) {
+        res = axdr_encode_integer(&writer->codec, i, INT32_MIN, INT32_MAX);
+        if (res == AXDR_ERROR_BUFFER_OVERFLOW) {
+            res = axdr_mmap_codec_reserve(writer, 4);
+            if (res == AXDR_SUCCESS) {
+                res = axdr_encode_integer(&writer->codec, i, INT32_MIN, INT32_MAX);
+            }
+        }
+    }
+    if (writer) {
+        res |= axdr_mmap_codec_close(writer);
+    }
+    printf("mmap append: %s\n", res == AXDR_SUCCESS ? "pass" : "fail");
+
+    // 以非页对齐偏移只读映射，直接在映射内存上解码
+    AXDR_MMAP_CODEC* reader = axdr_mmap_codec_open(path, 4 * 1000, 0);
+    int ok = reader != NULL && reader->codec.size == 4 * 49000;
+    for (int32_t i = 1000; ok && i < 50000; i++) {
+        int32_t value;
+        ok = axdr_decode_integer(&reader->codec, &value, INT32_MIN, INT32_MAX) == AXDR_SUCCESS && value == i;
+    }
+    if (ok) {
+        int32_t value;
+        ok = axdr_decode_integer(&reader->codec, &value, INT32_MIN, INT32_MAX) == AXDR_ERROR_BUFFER_OVERFLOW;
+    }
+    printf("mmap decode: %s\n", ok ? "pass" : "fail");
+
+    // 文件被截断后刷新，解码返回溢出而不是访问失效页面
+    ok = reader != NULL && truncate(path, 8) == 0 && axdr_mmap_codec_refresh(reader) != AXDR_SUCCESS;
+    if (ok) {
+        int32_t value;
+        reader->codec.position = 0;
+        ok = reader->codec.size == 0 &&
+             axdr_decode_integer(&reader->codec, &value, INT32_MIN, INT32_MAX) == AXDR_ERROR_BUFFER_OVERFLOW;
+    }
+    printf("mmap truncated: %s\n", ok ? "pass" : "fail");
+    if (reader) {
+        axdr_mmap_codec_close(reader);
+    }
+
+    // 超出文件末尾的区域得到空上下文
+    reader = axdr_mmap_codec_open(path, 1024, 0);
+    printf("mmap empty region: %s\n", (reader && reader->codec.size == 0) ? "pass" : "fail");
+    if (reader) {
+        axdr_mmap_codec_close(reader);
+    }
+
+    unlink(path);
+}
+
+int main() {
+    test_mmap_codec();
+    return 0;
+}
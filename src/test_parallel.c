@@ -0,0 +1,174 @@
+#include "axdr_parallel.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define READINGS 200000
+
+typedef struct {
+    int32_t  value;
+    uint32_t status;
+} READING;
+
+static int encode_reading(AXDR_CODEC* codec, const void* field) {
+    const READING* reading = (const READING*)field;
+    int res = axdr_encode_integer(codec, reading->value, -1000000, 1000000);
+    return res | axdr_encode_unsigned(codec, reading->status, 0xFFFF);
+}
+
+static int decode_reading(AXDR_CODEC* codec, void* field) {
+    READING* reading = (READING*)field;
+    int res = axdr_decode_integer(codec, &reading->value, -1000000, 1000000);
+    if (res != AXDR_SUCCESS) {
+        return res;
+    }
+    return axdr_decode_unsigned(codec, &reading->status, 0xFFFF);
+}
+
+// 变长元素：长度不一的表计名
+typedef char NAME[17];
+
+static int encode_name(AXDR_CODEC* codec, const void* field) {
+    return axdr_encode_visible_string(codec, (const char*)field, 16);
+}
+
+static int decode_name(AXDR_CODEC* codec, void* field) {
+    return axdr_decode_visible_string(codec, (char*)field, 16);
+}
+
+static int skip_name(AXDR_CODEC* codec) {
+    uint32_t length;
+    int res = axdr_decode_unsigned(codec, &length, 16);
+    if (res != AXDR_SUCCESS) {
+        return res;
+    }
+    if (length > codec->size - codec->position) {
+        return AXDR_ERROR_BUFFER_OVERFLOW;
+    }
+    codec->position += length;
+    return AXDR_SUCCESS;
+}
+
+// 与预扫描不一致的解码器：名称为 "x" 时多消耗 1 字节
+static int decode_name_overrun(AXDR_CODEC* codec, void* field) {
+    int res = decode_name(codec, field);
+    if (res == AXDR_SUCCESS && strcmp((const char*)field, "x") == 0) {
+        codec->position++;
+    }
+    return res;
+}
+
+void test_parallel() {
+    printf("\nTesting Parallel SEQUENCE OF Decode...\n");
+
+    AXDR_DECODE_POOL* pool = axdr_decode_pool_create(3);
+    READING* readings = (READING*)malloc(READINGS * sizeof(READING));
+    READING* decoded = (READING*)malloc(READINGS * sizeof(READING));
+    size_t bufferSize = 4 + READINGS * 8;
+    uint8_t* buffer = (uint8_t*)malloc(bufferSize);
+    for (size_t i = 0; i < READINGS; i++) {
+        readings[i].value = (int32_t)(i % 2000000) - 1000000;
+        readings[i].status = (uint32_t)(i & 0xFFFF);
+    }
+
+    // 定长元素
+    AXDR_SEQUENCE_OF source = {readings, sizeof(READING), READINGS, READINGS};
+    AXDR_CODEC codec;
+    axdr_codec_attach(&codec, buffer, bufferSize);
+    int res = axdr_encode_sequence_of(&codec, &source, encode_reading);
+    size_t length = codec.position;
+
+    AXDR_SEQUENCE_OF target = {decoded, sizeof(READING), 0, READINGS};
+    size_t failed;
+    axdr_codec_attach(&codec, buffer, length);
+    res |= axdr_decode_sequence_of_parallel(pool, &codec, &target, decode_reading, 8, NULL, &failed);
+    printf("Parallel fixed-size decode: %s\n",
+           (res == AXDR_SUCCESS && target.count == READINGS && codec.position == length &&
+            memcmp(readings, decoded, READINGS * sizeof(READING)) == 0) ? "pass" : "fail");
+
+    // 多处出错时报告序号最小的元素
+    uint8_t saved[2] = {buffer[4 + 150000 * 8 + 4], buffer[4 + 70000 * 8]};
+    buffer[4 + 150000 * 8 + 4] = 0x01;
+    buffer[4 + 70000 * 8] = 0x7F;
+    axdr_codec_attach(&codec, buffer, length);
+    res = axdr_decode_sequence_of_parallel(pool, &codec, &target, decode_reading, 8, NULL, &failed);
+    printf("Parallel lowest failing index: %s\n",
+           (res == AXDR_ERROR_CONSTRAINT && failed == 70000 && codec.position == 0) ? "pass" : "fail");
+
+    // 数据截断
+    buffer[4 + 150000 * 8 + 4] = saved[0];
+    buffer[4 + 70000 * 8] = saved[1];
+    axdr_codec_attach(&codec, buffer, length - 3);
+    res = axdr_decode_sequence_of_parallel(pool, &codec, &target, decode_reading, 8, NULL, &failed);
+    printf("Parallel truncated: %s\n",
+           (res == AXDR_ERROR_BUFFER_OVERFLOW && failed == READINGS - 1) ? "pass" : "fail");
+
+    // 变长元素：预扫描块边界
+    NAME* names = (NAME*)malloc(READINGS * sizeof(NAME));
+    NAME* decodedNames = (NAME*)malloc(READINGS * sizeof(NAME));
+    free(buffer);
+    bufferSize = 4 + READINGS * 20;
+    buffer = (uint8_t*)malloc(bufferSize);
+    for (size_t i = 0; i < READINGS; i++) {
+        snprintf(names[i], sizeof(NAME), "m%zu", i * 7919 % 100000000);
+    }
+    AXDR_SEQUENCE_OF nameSource = {names, sizeof(NAME), READINGS, READINGS};
+    axdr_codec_attach(&codec, buffer, bufferSize);
+    res = axdr_encode_sequence_of(&codec, &nameSource, encode_name);
+    length = codec.position;
+
+    AXDR_SEQUENCE_OF nameTarget = {decodedNames, sizeof(NAME), 0, READINGS};
+    axdr_codec_attach(&codec, buffer, length);
+    res |= axdr_decode_sequence_of_parallel(pool, &codec, &nameTarget, decode_name, 0, skip_name, &failed);
+    int same = res == AXDR_SUCCESS && nameTarget.count == READINGS && codec.position == length;
+    for (size_t i = 0; same && i < READINGS; i++) {
+        same = strcmp(names[i], decodedNames[i]) == 0;
+    }
+    printf("Parallel variable-size decode: %s\n", same ? "pass" : "fail");
+
+    // 变长元素中的非法字符：预扫描不检查内容，由解码发现
+    size_t offset = 4;
+    for (size_t i = 0; i < 123456; i++) {
+        offset += 4 + strlen(names[i]);
+    }
+    buffer[offset + 4] = 0x01;
+    axdr_codec_attach(&codec, buffer, length);
+    res = axdr_decode_sequence_of_parallel(pool, &codec, &nameTarget, decode_name, 0, skip_name, &failed);
+    printf("Parallel variable-size error: %s\n",
+           (res == AXDR_ERROR_INVALID_VALUE && failed == 123456) ? "pass" : "fail");
+
+    // 解码消耗的长度与预扫描的元素边界不一致：出错序号为该元素而不是块的最后一个元素
+    uint8_t small[64];
+    NAME few[4];
+    AXDR_SEQUENCE_OF fewTarget = {few, sizeof(NAME), 0, 4};
+    axdr_codec_attach(&codec, small, sizeof(small));
+    axdr_encode_unsigned(&codec, 4, UINT32_MAX);
+    const char* fewNames[4] = {"ab", "x", "cd", "ef"};
+    for (int i = 0; i < 4; i++) {
+        axdr_encode_visible_string(&codec, fewNames[i], 16);
+    }
+    size_t fewLength = codec.position;
+    axdr_codec_attach(&codec, small, fewLength);
+    failed = 0;
+    res = axdr_decode_sequence_of_parallel(pool, &codec, &fewTarget, decode_name_overrun, 0, skip_name, &failed);
+    printf("Parallel boundary mismatch: %s\n",
+           (res == AXDR_ERROR_INVALID_LENGTH && failed == 1 && codec.position == 0) ? "pass" : "fail");
+
+    // 无线程池时在调用线程中解码
+    buffer[offset + 4] = 'm';
+    axdr_codec_attach(&codec, buffer, length);
+    res = axdr_decode_sequence_of_parallel(NULL, &codec, &nameTarget, decode_name, 0, skip_name, &failed);
+    printf("Parallel without pool: %s\n", (res == AXDR_SUCCESS && codec.position == length) ? "pass" : "fail");
+
+    free(names);
+    free(decodedNames);
+    free(readings);
+    free(decoded);
+    free(buffer);
+    axdr_decode_pool_destroy(pool);
+}
+
+int main() {
+    test_parallel();
+    return 0;
+}
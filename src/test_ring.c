@@ -0,0 +1,100 @@
+#include "axdr.h"
+#include "axdr_ring.h"
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+
+#define RING_ITEMS     200000
+#define RING_PRODUCERS 2
+
+typedef struct {
+    AXDR_RING* ring;
+    uint32_t   base;
+} ProducerArgs;
+
+static void* produce(void* arg) {
+    ProducerArgs* args = (ProducerArgs*)arg;
+    uint32_t batch[16];
+    for (uint32_t i = 0; i < RING_ITEMS; i += 16) {
+        for (uint32_t k = 0; k < 16; k++) {
+            batch[k] = args->base + i + k;
+        }
+        size_t sent = 0;
+        while (sent < 16) {
+            sent += axdr_ring_enqueue_wait(args->ring, batch + sent, 16 - sent, 64, -1);
+        }
+    }
+    return NULL;
+}
+
+void test_ring_basic() {
+    printf("\nTesting Ring Buffer...\n");
+
+    // 单线程：容量、批量、回绕
+    AXDR_RING* ring = axdr_ring_create(5, sizeof(AXDR_CODEC), AXDR_RING_SPSC);
+    uint8_t frame[8] = {0};
+    AXDR_CODEC views[8];
+    for (int i = 0; i < 8; i++) {
+        axdr_codec_attach(&views[i], frame, (size_t)i + 1);
+    }
+    int ok = ring && ring->capacity == 8 && ring->slotStride % AXDR_CACHE_LINE == 0;
+    for (int round = 0; ok && round < 3; round++) {
+        AXDR_CODEC out[8];
+        ok = axdr_ring_enqueue(ring, views, 6) == 6 &&
+             axdr_ring_enqueue(ring, views + 6, 2) == 2 &&
+             axdr_ring_enqueue(ring, views, 1) == 0 &&
+             axdr_ring_dequeue(ring, out, 3) == 3 &&
+             axdr_ring_dequeue(ring, out + 3, 8) == 5 &&
+             axdr_ring_count(ring) == 0;
+        for (int i = 0; ok && i < 8; i++) {
+            ok = out[i].buffer == frame && out[i].size == (size_t)i + 1;
+        }
+    }
+    AXDR_CODEC out;
+    ok = ok && axdr_ring_dequeue_wait(ring, &out, 1, 10, 20) == 0;
+    printf("Ring SPSC batch: %s\n", ok ? "pass" : "fail");
+    axdr_ring_destroy(ring);
+}
+
+void test_ring_mpmc() {
+    // 多生产者多消费者：每个元素恰好被取出一次
+    AXDR_RING* ring = axdr_ring_create(256, sizeof(uint32_t), AXDR_RING_MPMC);
+    static uint8_t seen[RING_ITEMS * RING_PRODUCERS];
+    memset(seen, 0, sizeof(seen));
+
+    pthread_t threads[RING_PRODUCERS];
+    ProducerArgs args[RING_PRODUCERS];
+    for (int p = 0; p < RING_PRODUCERS; p++) {
+        args[p].ring = ring;
+        args[p].base = (uint32_t)p * RING_ITEMS;
+        pthread_create(&threads[p], NULL, produce, &args[p]);
+    }
+
+    int ok = 1;
+    size_t received = 0;
+    while (received < (size_t)RING_ITEMS * RING_PRODUCERS) {
+        uint32_t batch[32];
+        size_t n = axdr_ring_dequeue_wait(ring, batch, 32, 64, 5000);
+        if (n == 0) {
+            ok = 0;
+            break;
+        }
+        for (size_t i = 0; i < n; i++) {
+            if (batch[i] >= RING_ITEMS * RING_PRODUCERS || seen[batch[i]]++) {
+                ok = 0;
+            }
+        }
+        received += n;
+    }
+    for (int p = 0; p < RING_PRODUCERS; p++) {
+        pthread_join(threads[p], NULL);
+    }
+    printf("Ring MPMC threads: %s\n", ok ? "pass" : "fail");
+    axdr_ring_destroy(ring);
+}
+
+int main() {
+    test_ring_basic();
+    test_ring_mpmc();
+    return 0;
+}
@@ -0,0 +1,141 @@
+#include "axdr_scaled.h"
+#include "axdr_export.h"
+#include <stdio.h>
+#include <string.h>
+
+// 与 AVX2 路径相同的运算顺序逐个换算
+static double expected_value(uint32_t raw, const AXDR_SCALED_COLUMN* column) {
+    double x = column->isUnsigned ? (double)raw : (double)(int32_t)raw;
+    double power = 1.0;
+    for (int i = 0; i < (column->scaler < 0 ? -column->scaler : column->scaler); i++) {
+        power *= 10.0;
+    }
+    return column->scaler < 0 ? x / power : x * power;
+}
+
+void test_scaled() {
+    printf("\nTesting Floats and Scaled Decode...\n");
+
+    uint8_t buffer[4096];
+    AXDR_CODEC codec;
+
+    // float32 / float64：IEEE 754 高字节在前，特殊值原样传递
+    axdr_codec_attach(&codec, buffer, sizeof(buffer));
+    int res = axdr_encode_float32(&codec, 1.0f);
+    res |= axdr_encode_float64(&codec, -2.5);
+    res |= axdr_encode_float64(&codec, 1.0 / 0.0);
+    res |= axdr_encode_float32(&codec, 0.0f / 0.0f);
+    static const uint8_t expected[12] = {0x3F, 0x80, 0x00, 0x00, 0xC0, 0x04, 0, 0, 0, 0, 0, 0};
+    int ok = res == AXDR_SUCCESS && codec.position == 24 && memcmp(buffer, expected, 12) == 0;
+    float f;
+    double d;
+    size_t encoded = codec.position;
+    axdr_codec_attach(&codec, buffer, encoded);
+    res = axdr_decode_float32(&codec, &f);
+    ok &= res == AXDR_SUCCESS && f == 1.0f;
+    res = axdr_decode_float64(&codec, &d);
+    ok &= res == AXDR_SUCCESS && d == -2.5;
+    res = axdr_decode_float64(&codec, &d);
+    ok &= res == AXDR_SUCCESS && d > 1e308;
+    res = axdr_decode_float32(&codec, &f);
+    ok &= res == AXDR_SUCCESS && f != f && codec.position == encoded;
+    ok &= axdr_decode_float32(&codec, &f) == AXDR_ERROR_BUFFER_OVERFLOW;
+    printf("Float round trip: %s\n", ok ? "pass" : "fail");
+
+    // 单列：换算结果与十进制字面量相同
+    AXDR_SCALED_COLUMN energy = {-3, false};
+    axdr_codec_attach(&codec, buffer, sizeof(buffer));
+    const int32_t raws[6] = {1234, -1, 0, 100, 2147483647, -2147483647 - 1};
+    axdr_encode_unsigned(&codec, 6, UINT32_MAX);
+    for (int i = 0; i < 6; i++) {
+        axdr_encode_integer(&codec, raws[i], INT32_MIN, INT32_MAX);
+    }
+    encoded = codec.position;
+    double values[256];
+    size_t rows = 0;
+    axdr_codec_attach(&codec, buffer, encoded);
+    res = axdr_decode_scaled(&codec, values, &rows, 16, &energy, 1);
+    ok = res == AXDR_SUCCESS && rows == 6 && codec.position == encoded && values[0] == 1.234 &&
+         values[1] == -0.001 && values[2] == 0.0 && values[3] == 0.1 && values[4] == 2147483.647 &&
+         values[5] == -2147483.648;
+    printf("Scaled single column: %s\n", ok ? "pass" : "fail");
+
+    // 多列：每列各自的 scaler 与符号，行数不是向量宽度的整数倍
+    const AXDR_SCALED_COLUMN columns[3] = {{-2, false}, {3, false}, {0, true}};
+    uint32_t raw[3 * 41];
+    axdr_codec_attach(&codec, buffer, sizeof(buffer));
+    axdr_encode_unsigned(&codec, 41, UINT32_MAX);
+    for (size_t i = 0; i < 3 * 41; i++) {
+        raw[i] = (uint32_t)(i * 2654435761u);
+        axdr_encode_unsigned(&codec, raw[i], UINT32_MAX);
+    }
+    encoded = codec.position;
+    axdr_codec_attach(&codec, buffer, encoded);
+    res = axdr_decode_scaled(&codec, values, &rows, 64, columns, 3);
+    ok = res == AXDR_SUCCESS && rows == 41 && codec.position == encoded;
+    for (size_t i = 0; i < 3 * 41 && ok; i++) {
+        ok &= values[i] == expected_value(raw[i], &columns[i % 3]);
+    }
+    ok &= values[2 * 3 + 2] >= 0;
+    printf("Scaled columns: %s\n", ok ? "pass" : "fail");
+
+    // 编码：除以 10^scaler 后四舍五入，编码再解码得到相同的值
+    const double readings[6] = {1.234, -0.0015, 12.3456, 4000, 2.5, 4294967295.0};
+    const AXDR_SCALED_COLUMN pair[2] = {{-3, false}, {0, true}};
+    axdr_codec_attach(&codec, buffer, sizeof(buffer));
+    res = axdr_encode_scaled(&codec, readings, 3, pair, 2);
+    encoded = codec.position;
+    axdr_codec_attach(&codec, buffer, encoded);
+    res |= axdr_decode_scaled(&codec, values, &rows, 3, pair, 2);
+    ok = res == AXDR_SUCCESS && encoded == 4 + 6 * 4 && rows == 3 && values[0] == 1.234 &&
+         values[1] == 0.0 && values[2] == 12.346 && values[3] == 4000 && values[4] == 2.5 &&
+         values[5] == 4294967295.0;
+    printf("Scaled encode: %s\n", ok ? "pass" : "fail");
+
+    // 超出范围与非法参数
+    const double tooLarge[1] = {2147483.648};
+    const double negative[1] = {-1};
+    const double nan[1] = {0.0 / 0.0};
+    uint8_t scratch[64];
+    axdr_codec_attach(&codec, scratch, sizeof(scratch));
+    ok = axdr_encode_scaled(&codec, tooLarge, 1, &energy, 1) == AXDR_ERROR_CONSTRAINT && codec.position == 0;
+    ok &= axdr_encode_scaled(&codec, negative, 1, &pair[1], 1) == AXDR_ERROR_CONSTRAINT && codec.position == 0;
+    ok &= axdr_encode_scaled(&codec, nan, 1, &energy, 1) == AXDR_ERROR_INVALID_VALUE && codec.position == 0;
+    ok &= axdr_decode_scaled(&codec, values, &rows, 4, columns, 0) == AXDR_ERROR_INVALID_VALUE;
+    axdr_codec_attach(&codec, buffer, 4 + 5 * 4);
+    ok &= axdr_decode_scaled(&codec, values, &rows, 4, pair, 2) == AXDR_ERROR_BUFFER_OVERFLOW &&
+          codec.position == 0;
+    axdr_codec_attach(&codec, buffer, encoded);
+    ok &= axdr_decode_scaled(&codec, values, &rows, 2, pair, 2) == AXDR_ERROR_CONSTRAINT && codec.position == 0;
+    AXDR_DECODE_BUDGET budget;
+    axdr_budget_init(&budget, 0, 2, 0, 0);
+    codec.budget = &budget;
+    ok &= axdr_decode_scaled(&codec, values, &rows, 3, pair, 2) == AXDR_ERROR_BUDGET && codec.position == 0;
+    printf("Scaled limits: %s\n", ok ? "pass" : "fail");
+
+    // 模式中的浮点字段与导出
+    AXDR_SCHEMA* schema = axdr_schema_parse("{power:float32, energy:float64, bad:float64}");
+    ok = schema && schema->children[0].type == AXDR_TYPE_FLOAT32 && schema->children[1].type == AXDR_TYPE_FLOAT64;
+    if (schema) {
+        axdr_codec_attach(&codec, buffer, sizeof(buffer));
+        axdr_encode_float32(&codec, 0.1f);
+        axdr_encode_float64(&codec, 1234.5);
+        axdr_encode_float64(&codec, 0.0 / 0.0);
+        encoded = codec.position;
+        char out[256];
+        AXDR_EXPORTER exporter;
+        axdr_exporter_init(&exporter, AXDR_EXPORT_JSON, out, sizeof(out), -1);
+        axdr_codec_attach(&codec, buffer, encoded);
+        res = axdr_export_record(&exporter, &codec, schema);
+        const char* json = "{\"power\":0.100000001,\"energy\":1234.5,\"bad\":null}\n";
+        ok &= res == AXDR_SUCCESS && codec.position == encoded && exporter.length == strlen(json) &&
+              memcmp(out, json, exporter.length) == 0;
+        axdr_schema_free(schema);
+    }
+    printf("Float schema export: %s\n", ok ? "pass" : "fail");
+}
+
+int main() {
+    test_scaled();
+    return 0;
+}
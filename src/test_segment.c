@@ -0,0 +1,178 @@
+#include "axdr_segment.h"
+#include <stdio.h>
+#include <string.h>
+
+// 参考消息：各类字段混合，长度不同
+static size_t encode_message(uint8_t* buffer, size_t size) {
+    static const uint8_t octets[40] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+    AXDR_CODEC codec;
+    axdr_codec_attach(&codec, buffer, size);
+    int res = axdr_encode_unsigned(&codec, 123456, UINT32_MAX);
+    res |= axdr_encode_boolean(&codec, true);
+    res |= axdr_encode_varint(&codec, -70000);
+    res |= axdr_encode_visible_string(&codec, "1.0.99.1.0.255", 32);
+    res |= axdr_encode_integer(&codec, -42, -100, 100);
+    res |= axdr_encode_octet_string(&codec, octets, sizeof(octets));
+    res |= axdr_encode_enum(&codec, 3, 8);
+    return res == AXDR_SUCCESS ? codec.position : 0;
+}
+
+// 逐字段解码并核对
+static int decode_message(AXDR_SEGMENTED_CODEC* sc) {
+    uint32_t id = 0;
+    bool flag = false;
+    int32_t delta = 0;
+    char name[33] = "";
+    int32_t value = 0;
+    uint8_t octets[64] = {0};
+    size_t octetLength = 0;
+    int state = 0;
+    int res;
+
+    AXDR_SEGMENTED_DECODE(sc, res, axdr_decode_unsigned, &id, UINT32_MAX);
+    if (res != AXDR_SUCCESS || id != 123456) return 0;
+    AXDR_SEGMENTED_DECODE(sc, res, axdr_decode_boolean, &flag);
+    if (res != AXDR_SUCCESS || !flag) return 0;
+    AXDR_SEGMENTED_DECODE(sc, res, axdr_decode_varint, &delta);
+    if (res != AXDR_SUCCESS || delta != -70000) return 0;
+    AXDR_SEGMENTED_DECODE(sc, res, axdr_decode_visible_string, name, 32);
+    if (res != AXDR_SUCCESS || strcmp(name, "1.0.99.1.0.255") != 0) return 0;
+    AXDR_SEGMENTED_DECODE(sc, res, axdr_decode_integer, &value, -100, 100);
+    if (res != AXDR_SUCCESS || value != -42) return 0;
+    AXDR_SEGMENTED_DECODE(sc, res, axdr_decode_octet_string, octets, &octetLength);
+    if (res != AXDR_SUCCESS || octetLength != 40 || octets[9] != 10 || octets[39] != 0) return 0;
+    AXDR_SEGMENTED_DECODE(sc, res, axdr_decode_enum, &state, 8);
+    return res == AXDR_SUCCESS && state == 3 && axdr_segmented_remaining(sc) == 0;
+}
+
+static int decode_null_field(AXDR_CODEC* codec, void* field) {
+    (void)field;
+    return axdr_decode_null(codec);
+}
+
+static int decode_reading(AXDR_CODEC* codec, void* field) {
+    return axdr_decode_integer(codec, (int32_t*)field, INT32_MIN, INT32_MAX);
+}
+
+static int decode_readings(AXDR_CODEC* codec, void* field) {
+    return axdr_decode_sequence_of(codec, (AXDR_SEQUENCE_OF*)field, decode_reading);
+}
+
+void test_segment() {
+    printf("\nTesting Segmented Input Codec...\n");
+
+    uint8_t message[256];
+    size_t length = encode_message(message, sizeof(message));
+    uint8_t scratch[128];
+    AXDR_SEGMENTED_CODEC sc;
+
+    // 两段，在每个位置切开
+    int ok = length > 0;
+    for (size_t cut = 0; ok && cut <= length; cut++) {
+        AXDR_SEGMENT segments[2] = {{message, cut}, {message + cut, length - cut}};
+        axdr_segmented_init(&sc, segments, 2, scratch, sizeof(scratch));
+        ok = decode_message(&sc);
+    }
+    printf("Segmented two-way split: %s\n", ok ? "pass" : "fail");
+
+    // 1 至 7 字节的小段，含空段
+    AXDR_SEGMENT segments[256];
+    for (size_t step = 1; ok && step <= 7; step++) {
+        size_t count = 0;
+        for (size_t offset = 0; offset < length; offset += step) {
+            segments[count].data = message + offset;
+            segments[count].length = offset + step <= length ? step : length - offset;
+            count++;
+            segments[count].data = message;
+            segments[count].length = 0;
+            count++;
+        }
+        axdr_segmented_init(&sc, segments, count, scratch, sizeof(scratch));
+        ok = decode_message(&sc);
+    }
+    printf("Segmented small chunks: %s\n", ok ? "pass" : "fail");
+
+    // 环形缓冲区回绕
+    uint8_t ring[96];
+    ok = 1;
+    for (size_t start = 0; ok && start < sizeof(ring); start += 5) {
+        for (size_t i = 0; i < length; i++) {
+            ring[(start + i) % sizeof(ring)] = message[i];
+        }
+        AXDR_SEGMENT wrapped[2];
+        size_t count = axdr_segments_from_ring(wrapped, ring, sizeof(ring), start, length);
+        axdr_segmented_init(&sc, wrapped, count, scratch, sizeof(scratch));
+        ok = count == (start + length > sizeof(ring) ? 2u : 1u) && decode_message(&sc);
+    }
+    printf("Segmented ring wrap: %s\n", ok ? "pass" : "fail");
+
+    // 回调接口
+    AXDR_SEGMENT single = {message, 0};
+    axdr_segmented_init(&sc, &single, 1, scratch, sizeof(scratch));
+    printf("Segmented callback: %s\n",
+           axdr_segmented_decode(&sc, decode_null_field, NULL) == AXDR_SUCCESS ? "pass" : "fail");
+
+    // 截断的输入
+    AXDR_SEGMENT truncated[2] = {{message, 10}, {message + 10, 7}};
+    axdr_segmented_init(&sc, truncated, 2, scratch, sizeof(scratch));
+    int res;
+    AXDR_SEGMENTED_DECODE(&sc, res, axdr_decode_unsigned, &(uint32_t){0}, UINT32_MAX);
+    AXDR_SEGMENTED_DECODE(&sc, res, axdr_decode_boolean, &(bool){false});
+    AXDR_SEGMENTED_DECODE(&sc, res, axdr_decode_varint, &(int32_t){0});
+    char name[33];
+    AXDR_SEGMENTED_DECODE(&sc, res, axdr_decode_visible_string, name, 32);
+    printf("Segmented truncated: %s\n",
+           (res == AXDR_ERROR_BUFFER_OVERFLOW && sc.consumed == 10 && sc.stitched == 0) ? "pass" : "fail");
+
+    // 拼接缓冲区容纳不下跨边界的字段
+    uint8_t large[64];
+    AXDR_CODEC codec;
+    axdr_codec_attach(&codec, large, sizeof(large));
+    axdr_encode_octet_string(&codec, message, 40);
+    AXDR_SEGMENT split[2] = {{large, 10}, {large + 10, codec.position - 10}};
+    uint8_t octets[64];
+    size_t octetLength;
+    axdr_segmented_init(&sc, split, 2, scratch, 16);
+    AXDR_SEGMENTED_DECODE(&sc, res, axdr_decode_octet_string, octets, &octetLength);
+    int limited = res == AXDR_ERROR_BUFFER_OVERFLOW && sc.consumed == 0;
+    axdr_segmented_init(&sc, split, 2, scratch, 64);
+    AXDR_SEGMENTED_DECODE(&sc, res, axdr_decode_octet_string, octets, &octetLength);
+    printf("Segmented scratch limit: %s\n",
+           (limited && res == AXDR_SUCCESS && octetLength == 40) ? "pass" : "fail");
+
+    // 出错位置相对整个输入
+    uint8_t bad[32];
+    axdr_codec_attach(&codec, bad, sizeof(bad));
+    axdr_encode_unsigned(&codec, 1, UINT32_MAX);
+    axdr_encode_octet_string(&codec, (const uint8_t*)"ab\x01" "d", 4);
+    AXDR_SEGMENT parts[2] = {{bad, 6}, {bad + 6, codec.position - 6}};
+    axdr_segmented_init(&sc, parts, 2, scratch, sizeof(scratch));
+    AXDR_SEGMENTED_DECODE(&sc, res, axdr_decode_unsigned, &(uint32_t){0}, UINT32_MAX);
+    AXDR_SEGMENTED_DECODE(&sc, res, axdr_decode_visible_string, name, 32);
+    printf("Segmented error offset: %s\n",
+           (res == AXDR_ERROR_INVALID_VALUE && sc.codec.errorOffset == 10 && sc.consumed == 4) ? "pass" : "fail");
+
+    // 跨边界重试不重复计入预算：10 个元素的 SEQUENCE OF 拆成 30 + 14 字节
+    uint8_t list[64];
+    axdr_codec_attach(&codec, list, sizeof(list));
+    axdr_encode_unsigned(&codec, 10, 16);
+    for (int i = 0; i < 10; i++) {
+        axdr_encode_integer(&codec, i, INT32_MIN, INT32_MAX);
+    }
+    int32_t readings[16];
+    AXDR_SEQUENCE_OF sequence = {readings, sizeof(int32_t), 0, 16};
+    AXDR_SEGMENT halves[2] = {{list, 30}, {list + 30, codec.position - 30}};
+    AXDR_DECODE_BUDGET budget;
+    axdr_budget_init(&budget, 0, 15, 1, 15);
+    axdr_segmented_init(&sc, halves, 2, scratch, sizeof(scratch));
+    sc.codec.budget = &budget;
+    res = axdr_segmented_decode(&sc, decode_readings, &sequence);
+    printf("Segmented budget retry: %s\n",
+           (res == AXDR_SUCCESS && sequence.count == 10 && readings[9] == 9 && budget.elements == 10 &&
+            budget.work == 10 && budget.depth == 0 && axdr_segmented_remaining(&sc) == 0) ? "pass" : "fail");
+}
+
+int main() {
+    test_segment();
+    return 0;
+}
@@ -0,0 +1,76 @@
+#include "axdr_template.h"
+#include <stdio.h>
+#include <string.h>
+
+#define FIELD_INVOKE_ID  0
+#define FIELD_ADDRESS    1
+#define FIELD_TIMESTAMP  2
+
+// 轮询请求：调用标识、表计地址、时间戳、固定的属性描述
+static int encode_poll(AXDR_CODEC* codec, AXDR_TEMPLATE* tpl, uint32_t invokeId,
+                       const uint8_t* address, size_t addressLength, uint32_t timestamp) {
+    int res = AXDR_SUCCESS;
+    if (tpl) res |= axdr_template_field_begin(tpl, FIELD_INVOKE_ID);
+    res |= axdr_encode_unsigned(codec, invokeId, UINT32_MAX);
+    if (tpl) res |= axdr_template_field_end(tpl, FIELD_INVOKE_ID);
+    if (tpl) res |= axdr_template_field_begin(tpl, FIELD_ADDRESS);
+    res |= axdr_encode_octet_string(codec, address, addressLength);
+    if (tpl) res |= axdr_template_field_end(tpl, FIELD_ADDRESS);
+    res |= axdr_encode_enum(codec, 2, 4);
+    if (tpl) res |= axdr_template_field_begin(tpl, FIELD_TIMESTAMP);
+    res |= axdr_encode_unsigned(codec, timestamp, UINT32_MAX);
+    if (tpl) res |= axdr_template_field_end(tpl, FIELD_TIMESTAMP);
+    res |= axdr_encode_visible_string(codec, "1.0.1.8.0.255", 32);
+    return res;
+}
+
+static int encode_timestamp(AXDR_CODEC* codec, const void* field) {
+    return axdr_encode_unsigned(codec, *(const uint32_t*)field, UINT32_MAX);
+}
+
+void test_template() {
+    printf("\nTesting Message Template...\n");
+
+    const uint8_t address[6] = {0x00, 0x00, 0x12, 0x34, 0x56, 0x78};
+    uint8_t buffer[128];
+    AXDR_CODEC codec;
+    axdr_codec_attach(&codec, buffer, sizeof(buffer));
+
+    AXDR_TEMPLATE tpl;
+    int res = axdr_template_begin(&tpl, &codec);
+    res |= encode_poll(&codec, &tpl, 0, address, sizeof(address), 0);
+    res |= axdr_template_end(&tpl);
+
+    // 拷贝模板并改写字段，与完整编码逐字节一致
+    const uint8_t other[6] = {0x00, 0x00, 0x99, 0x88, 0x77, 0x66};
+    uint8_t expected[128];
+    AXDR_CODEC reference;
+    axdr_codec_attach(&reference, expected, sizeof(expected));
+    res |= encode_poll(&reference, NULL, 42, other, sizeof(other), 1700000000u);
+
+    uint32_t timestamp = 1700000000u;
+    size_t start;
+    axdr_codec_attach(&codec, buffer, sizeof(buffer));
+    res |= axdr_template_instantiate(&tpl, &codec, &start);
+    res |= axdr_template_patch_unsigned(&tpl, &codec, start, FIELD_INVOKE_ID, 42, UINT32_MAX);
+    res |= axdr_template_patch_octet_string(&tpl, &codec, start, FIELD_ADDRESS, other, sizeof(other));
+    res |= axdr_template_patch_field(&tpl, &codec, start, FIELD_TIMESTAMP, encode_timestamp, &timestamp);
+    printf("Template patch: %s\n",
+           (res == AXDR_SUCCESS && codec.position == reference.position &&
+            memcmp(buffer, expected, codec.position) == 0) ? "pass" : "fail");
+
+    // 变长字段长度变化时要求退回完整编码
+    res = axdr_template_patch_octet_string(&tpl, &codec, start, FIELD_ADDRESS, other, 4);
+    printf("Template layout change: %s\n", res == AXDR_ERROR_LAYOUT_CHANGED ? "pass" : "fail");
+
+    // 约束检查仍然生效
+    res = axdr_template_patch_integer(&tpl, &codec, start, FIELD_INVOKE_ID, 5, 0, 3);
+    printf("Template constraint: %s\n", res == AXDR_ERROR_CONSTRAINT ? "pass" : "fail");
+
+    axdr_template_cleanup(&tpl);
+}
+
+int main() {
+    test_template();
+    return 0;
+}
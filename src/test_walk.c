@@ -0,0 +1,181 @@
+#include "axdr_walk.h"
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+
+// 负荷曲线：profile{id, name, entries[{time, captures[{scaler, reading{value, status}}]}]}
+// 共 6 层容器嵌套
+
+#define MAX_ENTRIES   4
+#define MAX_CAPTURES  8
+
+typedef struct {
+    int32_t value;
+    uint8_t status[2];
+    size_t  statusBits;
+} READING;
+
+typedef struct {
+    int32_t scaler;
+    READING reading;
+} CAPTURE;
+
+typedef struct {
+    uint32_t         time;
+    AXDR_SEQUENCE_OF captures;
+} ENTRY;
+
+typedef struct {
+    uint32_t         id;
+    char             name[17];
+    AXDR_SEQUENCE_OF entries;
+} PROFILE;
+
+static const AXDR_SCHEMA reading_fields[] = {
+    {.type = AXDR_TYPE_INTEGER, .name = "value", .min = INT32_MIN, .max = INT32_MAX,
+     .offset = offsetof(READING, value)},
+    {.type = AXDR_TYPE_BIT_STRING, .name = "status", .maxLength = 16,
+     .offset = offsetof(READING, status), .lengthOffset = offsetof(READING, statusBits)},
+};
+
+static const AXDR_SCHEMA capture_fields[] = {
+    {.type = AXDR_TYPE_INTEGER, .name = "scaler", .min = -10, .max = 10,
+     .offset = offsetof(CAPTURE, scaler)},
+    {.type = AXDR_TYPE_SEQUENCE, .name = "reading", .children = reading_fields, .childCount = 2,
+     .offset = offsetof(CAPTURE, reading)},
+};
+
+static const AXDR_SCHEMA capture_schema[] = {
+    {.type = AXDR_TYPE_SEQUENCE, .children = capture_fields, .childCount = 2},
+};
+
+static const AXDR_SCHEMA entry_fields[] = {
+    {.type = AXDR_TYPE_UNSIGNED, .name = "time", .max = UINT32_MAX, .offset = offsetof(ENTRY, time)},
+    {.type = AXDR_TYPE_SEQUENCE_OF, .name = "captures", .maxLength = MAX_CAPTURES,
+     .children = capture_schema, .childCount = 1, .offset = offsetof(ENTRY, captures)},
+};
+
+static const AXDR_SCHEMA entry_schema[] = {
+    {.type = AXDR_TYPE_SEQUENCE, .children = entry_fields, .childCount = 2},
+};
+
+static const AXDR_SCHEMA profile_fields[] = {
+    {.type = AXDR_TYPE_UNSIGNED, .name = "id", .max = UINT32_MAX, .offset = offsetof(PROFILE, id)},
+    {.type = AXDR_TYPE_VISIBLE_STRING, .name = "name", .maxLength = 16, .offset = offsetof(PROFILE, name)},
+    {.type = AXDR_TYPE_SEQUENCE_OF, .name = "entries", .maxLength = MAX_ENTRIES,
+     .children = entry_schema, .childCount = 1, .offset = offsetof(PROFILE, entries)},
+};
+
+static const AXDR_SCHEMA profile_schema = {
+    .type = AXDR_TYPE_SEQUENCE, .name = "profile", .children = profile_fields, .childCount = 3,
+};
+
+// 用基本编码函数构造参考数据
+static size_t encode_profile(uint8_t* buffer, size_t size, size_t entries, size_t captures) {
+    AXDR_CODEC codec;
+    axdr_codec_attach(&codec, buffer, size);
+    int res = axdr_encode_unsigned(&codec, 7, UINT32_MAX);
+    res |= axdr_encode_visible_string(&codec, "1.0.99.1.0.255", 16);
+    res |= axdr_encode_unsigned(&codec, (uint32_t)entries, MAX_ENTRIES);
+    for (size_t e = 0; e < entries; e++) {
+        res |= axdr_encode_unsigned(&codec, 1700000000u + (uint32_t)e * 900, UINT32_MAX);
+        res |= axdr_encode_unsigned(&codec, (uint32_t)captures, MAX_CAPTURES);
+        for (size_t c = 0; c < captures; c++) {
+            const uint8_t status[2] = {(uint8_t)e, (uint8_t)c};
+            res |= axdr_encode_integer(&codec, -3, -10, 10);
+            res |= axdr_encode_integer(&codec, (int32_t)(e * 1000 + c), INT32_MIN, INT32_MAX);
+            res |= axdr_encode_bit_string(&codec, status, 12);
+        }
+    }
+    return res == AXDR_SUCCESS ? codec.position : 0;
+}
+
+static void prepare_profile(PROFILE* profile, ENTRY* entries, CAPTURE captures[][MAX_CAPTURES]) {
+    memset(profile, 0, sizeof(PROFILE));
+    profile->entries.elements = entries;
+    profile->entries.elementSize = sizeof(ENTRY);
+    profile->entries.maxCount = MAX_ENTRIES;
+    for (size_t e = 0; e < MAX_ENTRIES; e++) {
+        memset(&entries[e], 0, sizeof(ENTRY));
+        entries[e].captures.elements = captures[e];
+        entries[e].captures.elementSize = sizeof(CAPTURE);
+        entries[e].captures.maxCount = MAX_CAPTURES;
+    }
+}
+
+void test_walk() {
+    printf("\nTesting Iterative Schema Walker...\n");
+
+    uint8_t buffer[1024];
+    size_t length = encode_profile(buffer, sizeof(buffer), 3, 5);
+
+    PROFILE profile;
+    ENTRY entries[MAX_ENTRIES];
+    CAPTURE captures[MAX_ENTRIES][MAX_CAPTURES];
+    AXDR_WALK_FRAME frames[AXDR_WALK_DEFAULT_DEPTH];
+    AXDR_WALKER walker;
+    AXDR_CODEC codec;
+
+    // 完整解码
+    prepare_profile(&profile, entries, captures);
+    axdr_walker_init(&walker, frames, AXDR_WALK_DEFAULT_DEPTH);
+    axdr_codec_attach(&codec, buffer, length);
+    int res = axdr_walk_decode(&walker, &codec, &profile_schema, &profile);
+    int ok = res == AXDR_SUCCESS && codec.position == length && profile.id == 7 &&
+             strcmp(profile.name, "1.0.99.1.0.255") == 0 && profile.entries.count == 3;
+    for (size_t e = 0; ok && e < 3; e++) {
+        ok = entries[e].time == 1700000000u + e * 900 && entries[e].captures.count == 5;
+        for (size_t c = 0; ok && c < 5; c++) {
+            const CAPTURE* capture = &captures[e][c];
+            ok = capture->scaler == -3 && capture->reading.value == (int32_t)(e * 1000 + c) &&
+                 capture->reading.statusBits == 12 && capture->reading.status[0] == e &&
+                 capture->reading.status[1] == c;
+        }
+    }
+    printf("Walk decode nested profile: %s\n", ok ? "pass" : "fail");
+
+    // 只校验不写入
+    axdr_codec_attach(&codec, buffer, length);
+    res = axdr_walk_decode(&walker, &codec, &profile_schema, NULL);
+    printf("Walk skip: %s\n", (res == AXDR_SUCCESS && codec.position == length) ? "pass" : "fail");
+
+    // 深度限制：6 层嵌套在 5 层的栈上失败
+    AXDR_WALKER shallow;
+    axdr_walker_init(&shallow, frames, 5);
+    prepare_profile(&profile, entries, captures);
+    axdr_codec_attach(&codec, buffer, length);
+    res = axdr_walk_decode(&shallow, &codec, &profile_schema, &profile);
+    printf("Walk depth limit: %s\n", res == AXDR_ERROR_CONSTRAINT ? "pass" : "fail");
+
+    // 元素个数超过目标容量
+    length = encode_profile(buffer, sizeof(buffer), 4, 5);
+    prepare_profile(&profile, entries, captures);
+    profile.entries.maxCount = 2;
+    axdr_codec_attach(&codec, buffer, length);
+    res = axdr_walk_decode(&walker, &codec, &profile_schema, &profile);
+    printf("Walk element capacity: %s\n", res == AXDR_ERROR_CONSTRAINT ? "pass" : "fail");
+
+    // 截断的数据
+    axdr_codec_attach(&codec, buffer, length - 3);
+    res = axdr_walk_decode(&walker, &codec, &profile_schema, NULL);
+    printf("Walk truncated: %s\n", res == AXDR_ERROR_BUFFER_OVERFLOW ? "pass" : "fail");
+
+    // 名称中的不可见字符：与 axdr_decode_visible_string 相同的错误与 errorOffset，跳过时也校验
+    buffer[8 + 3] = 0x80;
+    prepare_profile(&profile, entries, captures);
+    axdr_codec_attach(&codec, buffer, length);
+    res = axdr_walk_decode(&walker, &codec, &profile_schema, &profile);
+    ok = res == AXDR_ERROR_INVALID_VALUE && codec.error == AXDR_ERROR_INVALID_VALUE && codec.errorOffset == 11;
+    axdr_codec_attach(&codec, buffer, length);
+    res = axdr_walk_decode(&walker, &codec, &profile_schema, NULL);
+    ok &= res == AXDR_ERROR_INVALID_VALUE && codec.errorOffset == 11;
+    char name[17];
+    axdr_codec_attach(&codec, buffer + 4, length - 4);
+    ok &= axdr_decode_visible_string(&codec, name, 16) == AXDR_ERROR_INVALID_VALUE && codec.errorOffset == 7;
+    printf("Walk visible string: %s\n", ok ? "pass" : "fail");
+}
+
+int main() {
+    test_walk();
+    return 0;
+}